@@ -0,0 +1,61 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_BENCH_CORPUS_HPP
+#define BREEZY_BENCH_CORPUS_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace breezy::bench {
+    struct Corpus {
+        std::string name;
+        std::string source;
+    };
+
+    /*
+    ============================
+    Synthetic corpora
+
+    Each corpus stresses one part of the pipeline with about `statements` top-level
+    statements; the same size always yields the same sources, so runs compare.
+
+        var_decls         long chains of declarations and arithmetic
+        call_nesting      deeply nested native calls and parentheses
+        long_identifiers  identifiers of 64 to 255 characters
+        numeric_literals  long integer, decimal and exponent literals
+        blocks            nested scopes with locals, comparisons and printing
+    ============================
+    */
+
+    std::vector<Corpus> generate_corpora(std::size_t statements);
+}
+
+#endif // !BREEZY_BENCH_CORPUS_HPP
@@ -0,0 +1,144 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "corpus.hpp"
+
+#include <cstdint>
+
+namespace breezy::bench {
+    namespace {
+        // Fixed-seed generator, so a corpus does not depend on the standard library
+        class Random {
+        public:
+            std::uint32_t next(std::uint32_t bound) {
+                state_ = state_ * 6364136223846793005ull + 1442695040888963407ull;
+                return static_cast<std::uint32_t>(state_ >> 33) % bound;
+            }
+
+        private:
+            std::uint64_t state_ = 0x9E3779B97F4A7C15ull;
+        };
+
+        std::string var_decls(std::size_t count) {
+            std::string out = "var v0 = 1;\n";
+            for (std::size_t i = 1; i < count; ++i) {
+                std::string prev = "v" + std::to_string(i - 1);
+                out += "var v" + std::to_string(i) + " = " + prev + " * 3 - " + std::to_string(i % 97)
+                     + " + (" + prev + " % 7) / 2;\n";
+            }
+            return out;
+        }
+
+        std::string call_nesting(std::size_t count) {
+            constexpr int depth = 48;
+
+            std::string out;
+            for (std::size_t i = 0; i < count; ++i) {
+                std::string expr = std::to_string(i);
+                for (int d = 0; d < depth; ++d) {
+                    switch (d % 4) {
+                        case 0: expr = "abs(" + expr + ")"; break;
+                        case 1: expr = "min(" + expr + ", " + std::to_string(d * 1000) + ")"; break;
+                        case 2: expr = "(" + expr + " + 1)"; break;
+                        default: expr = "max(-1, " + expr + ")"; break;
+                    }
+                }
+                out += "var c" + std::to_string(i % 64) + " = " + expr + ";\n";
+            }
+            return out;
+        }
+
+        std::string long_identifiers(std::size_t count) {
+            static const char letters[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+
+            Random random;
+            std::vector<std::string> names(256);
+            for (std::size_t n = 0; n < names.size(); ++n) {
+                std::size_t length = 64 + random.next(192);
+                for (std::size_t c = 0; c < length; ++c) {
+                    names[n] += letters[random.next(sizeof(letters) - 1)];
+                }
+                names[n] += std::to_string(n); // distinct even if the letters collide
+            }
+
+            std::string out = "var " + names[0] + " = 0;\n";
+            for (std::size_t i = 1; i < count; ++i) {
+                const std::string& name = names[i % names.size()];
+                const std::string& prev = names[(i - 1) % names.size()];
+                out += "var " + name + " = " + prev + " + 1;\n";
+            }
+            return out;
+        }
+
+        std::string numeric_literals(std::size_t count) {
+            Random random;
+            std::string out;
+            for (std::size_t i = 0; i < count; ++i) {
+                std::string integer = std::to_string(1 + random.next(9));
+                for (int d = 0; d < 17; ++d) integer += static_cast<char>('0' + random.next(10));
+
+                std::string decimal = std::to_string(random.next(100000)) + ".";
+                for (int d = 0; d < 15; ++d) decimal += static_cast<char>('0' + random.next(10));
+
+                std::string exponent = std::to_string(1 + random.next(9)) + "." + std::to_string(random.next(1000000))
+                                     + "e" + (random.next(2) ? "+" : "-") + std::to_string(random.next(300));
+
+                out += "var n" + std::to_string(i % 32) + " = " + integer + " + " + decimal + " * " + exponent + ";\n";
+            }
+            return out;
+        }
+
+        std::string blocks(std::size_t count) {
+            std::string out = "var total = 0;\n";
+            for (std::size_t i = 1; i < count; i += 8) {
+                std::string n = std::to_string(i);
+                out += "{\n"
+                       "    var a = " + n + ";\n"
+                       "    var b = a * 2 + 1;\n"
+                       "    {\n"
+                       "        var c = a < b && b <= " + n + " * 3;\n"
+                       "        var d = !c || a == b;\n"
+                       "        print(a, b, c, d);\n"
+                       "    }\n"
+                       "}\n";
+            }
+            return out;
+        }
+    }
+
+    std::vector<Corpus> generate_corpora(std::size_t statements) {
+        return {
+            { "var_decls", var_decls(statements) },
+            { "call_nesting", call_nesting(statements) },
+            { "long_identifiers", long_identifiers(statements) },
+            { "numeric_literals", numeric_literals(statements) },
+            { "blocks", blocks(statements) }
+        };
+    }
+}
@@ -0,0 +1,349 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#ifdef _WIN32
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#  include <psapi.h>
+#else
+#  include <sys/resource.h>
+#endif
+
+#include "breezy/diagnostics/runtime_stats.hpp"
+#include "breezy/frontend/ast.hpp"
+#include "breezy/frontend/interpreter.hpp"
+#include "breezy/frontend/lexer.hpp"
+#include "breezy/frontend/parser.hpp"
+#include "breezy/frontend/resolver.hpp"
+#include "breezy/frontend/symbol_table.hpp"
+#include "breezy/io/output_sink.hpp"
+#include "breezy/memory/heap.hpp"
+#include "breezy/vm/compiler.hpp"
+#include "breezy/vm/natives.hpp"
+#include "breezy/vm/vm.hpp"
+
+#include "corpus.hpp"
+
+/*
+    breezy_bench [--size N] [--min-time SECONDS] [--output FILE]
+
+    Measures each pipeline stage separately on every synthetic corpus and prints the
+    results as JSON:
+
+        lex        Lexer::tokenize                         tokens/s, bytes/s
+        parse      Parser::parse, lexing on demand         nodes/s
+        interpret  Interpreter::execute on the resolved    statements/s
+                   tree
+        vm         VirtualMachine::run on the compiled     statements/s
+                   chunk
+
+    Every stage repeats until it has run for at least --min-time, and reports the
+    mean time per pass. Script output goes to a discarding writer.
+*/
+
+namespace {
+    using namespace breezy::runtime;
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::size_t size = 20000;
+        double min_time = 0.5;
+        std::string output;
+    };
+
+    struct Stage {
+        const char* name;
+        const char* unit;
+        double seconds = 0.0; // mean per pass
+        std::size_t items = 0; // processed per pass
+    };
+
+    struct Result {
+        std::string name;
+        std::size_t bytes = 0;
+        std::vector<Stage> stages;
+    };
+
+    void discard_output(OutputStream, const char*, std::size_t, void*) {}
+
+    // Runs `pass` until `min_time` seconds have gone by; returns the mean per pass.
+    template <typename Pass>
+    double time_passes(double min_time, Pass&& pass) {
+        std::size_t passes = 0;
+        Clock::time_point start = Clock::now();
+        double elapsed = 0.0;
+        do {
+            pass();
+            ++passes;
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        } while (elapsed < min_time);
+        return elapsed / static_cast<double>(passes);
+    }
+
+    /* ==== AST node counts ==== */
+
+    std::size_t count_nodes(const Expr& expr) {
+        return 1 + std::visit([](auto&& node) -> std::size_t {
+            using T = std::decay_t<decltype(node)>;
+            if constexpr (std::is_same_v<T, CallExpr>) {
+                std::size_t count = 0;
+                for (const Expr& argument : node.arguments) count += count_nodes(argument);
+                return count;
+            }
+            else if constexpr (std::is_same_v<T, UnaryExpr>) {
+                return count_nodes(*node.operand);
+            }
+            else if constexpr (std::is_same_v<T, BinaryExpr>) {
+                return count_nodes(*node.left) + count_nodes(*node.right);
+            }
+            else {
+                return 0;
+            }
+        }, expr);
+    }
+
+    // Adds the statements and all nodes below `stmt` to the two counters
+    void count_nodes(const Stmt& stmt, std::size_t& nodes, std::size_t& statements) {
+        ++nodes;
+        ++statements;
+        std::visit([&](auto&& node) {
+            using T = std::decay_t<decltype(node)>;
+            if constexpr (std::is_same_v<T, VarDeclStmt>) {
+                if (node.initializer) nodes += count_nodes(*node.initializer);
+            }
+            else if constexpr (std::is_same_v<T, ExprStmt>) {
+                nodes += count_nodes(node.expression);
+            }
+            else {
+                for (const Stmt& child : node.statements) count_nodes(child, nodes, statements);
+            }
+        }, stmt);
+    }
+
+    /* ==== Stages ==== */
+
+    Result run_corpus(const breezy::bench::Corpus& corpus, double min_time) {
+        Result result{ corpus.name, corpus.source.size(), {} };
+
+        // Interning is part of lexing, but later passes would only hit the table, so
+        // every pass gets a fresh one
+        std::size_t tokens = 0;
+        double lex = time_passes(min_time, [&] {
+            SymbolTable symbols;
+            Lexer lexer(corpus.source, symbols);
+            tokens = lexer.tokenize().size();
+        });
+        result.stages.push_back({ "lex", "tokens", lex, tokens });
+        result.stages.push_back({ "lex", "bytes", lex, corpus.source.size() });
+
+        double parse = time_passes(min_time, [&] {
+            SymbolTable symbols;
+            CompilationUnit unit;
+            Lexer lexer(corpus.source, symbols);
+            Parser parser(lexer, unit.arena);
+            unit.statements = parser.parse();
+        });
+
+        // One resolved tree, shared by the execution stages
+        SymbolTable symbols;
+        NativeRegistry natives(symbols);
+        CompilationUnit unit;
+        Lexer lexer(corpus.source, symbols);
+        Parser parser(lexer, unit.arena);
+        unit.statements = parser.parse();
+        Resolver resolver(symbols, natives);
+        resolver.resolve(unit, corpus.source);
+
+        std::size_t nodes = 0;
+        std::size_t statements = 0;
+        for (const Stmt& stmt : unit.statements) count_nodes(stmt, nodes, statements);
+        result.stages.push_back({ "parse", "nodes", parse, nodes });
+
+        OutputSink output;
+        output.set_writer(discard_output, nullptr);
+        RuntimeStats stats; // only needed to satisfy the engines
+
+        double interpret = time_passes(min_time, [&] {
+            Heap heap;
+            std::vector<Value> slots;
+            Interpreter interpreter(heap, natives, output, slots, stats);
+            interpreter.ensure_globals(resolver.global_count());
+            for (const Stmt& stmt : unit.statements) interpreter.execute(stmt);
+            output.flush();
+        });
+        result.stages.push_back({ "interpret", "statements", interpret, statements });
+
+        Heap constants;
+        Chunk chunk = Compiler(constants, natives).compile(unit, resolver.global_count());
+        std::vector<std::uint32_t> links;
+        for (const NativeImport& import : chunk.imports) links.push_back(import.native);
+
+        double vm = time_passes(min_time, [&] {
+            Heap heap;
+            std::vector<Value> registers;
+            VirtualMachine machine(heap, natives, output, registers, stats);
+            machine.run(chunk, links);
+            output.flush();
+        });
+        result.stages.push_back({ "vm", "statements", vm, statements });
+
+        return result;
+    }
+
+    std::size_t peak_rss_bytes() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return counters.PeakWorkingSetSize;
+        }
+        return 0;
+#else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+#  ifdef __APPLE__
+        return static_cast<std::size_t>(usage.ru_maxrss);          // bytes
+#  else
+        return static_cast<std::size_t>(usage.ru_maxrss) * 1024;   // kilobytes
+#  endif
+#endif
+    }
+
+    /* ==== JSON ==== */
+
+    // Measurements: seconds and rates. Counts are integers and are written exactly.
+    std::string number(double value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.6g", value);
+        return buffer;
+    }
+
+    std::string to_json(const std::vector<Result>& results, const Options& options) {
+        std::ostringstream out;
+        out << "{\n"
+            << "  \"size\": " << options.size << ",\n"
+            << "  \"min_time\": " << number(options.min_time) << ",\n"
+            << "  \"corpora\": [\n";
+
+        for (std::size_t r = 0; r < results.size(); ++r) {
+            const Result& result = results[r];
+            out << "    {\n"
+                << "      \"name\": \"" << result.name << "\",\n"
+                << "      \"bytes\": " << result.bytes << ",\n"
+                << "      \"stages\": [\n";
+            for (std::size_t s = 0; s < result.stages.size(); ++s) {
+                const Stage& stage = result.stages[s];
+                out << "        { \"stage\": \"" << stage.name << "\", \"unit\": \"" << stage.unit
+                    << "\", \"count\": " << stage.items
+                    << ", \"seconds\": " << number(stage.seconds)
+                    << ", \"per_second\": " << number(static_cast<double>(stage.items) / stage.seconds) << " }"
+                    << (s + 1 < result.stages.size() ? ",\n" : "\n");
+            }
+            out << "      ]\n"
+                << "    }" << (r + 1 < results.size() ? ",\n" : "\n");
+        }
+
+        out << "  ],\n"
+            << "  \"peak_rss_bytes\": " << peak_rss_bytes() << "\n"
+            << "}\n";
+        return out.str();
+    }
+
+    bool parse_options(int argc, char* argv[], Options& options) {
+        for (int i = 1; i < argc; ++i) {
+            std::string option = argv[i];
+            if (i + 1 >= argc) return false;
+            std::string value = argv[++i];
+
+            char* end = nullptr;
+            if (option == "--size") {
+                options.size = std::strtoull(value.c_str(), &end, 10);
+                if (*end || options.size == 0) return false;
+            }
+            else if (option == "--min-time") {
+                options.min_time = std::strtod(value.c_str(), &end);
+                if (*end || options.min_time < 0) return false;
+            }
+            else if (option == "--output") {
+                options.output = value;
+            }
+            else {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "Usage: breezy_bench [--size N] [--min-time SECONDS] [--output FILE]\n";
+        return -3;
+    }
+
+    std::vector<Result> results;
+    try {
+        for (const auto& corpus : breezy::bench::generate_corpora(options.size)) {
+            std::cerr << "benchmarking " << corpus.name << "...\n";
+            results.push_back(run_corpus(corpus, options.min_time));
+        }
+    }
+    catch (const std::runtime_error& e) {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return -1;
+    }
+
+    std::string json = to_json(results, options);
+    if (options.output.empty()) {
+        std::cout << json;
+        return 0;
+    }
+
+    std::ofstream file(options.output);
+    file << json;
+    if (!file) {
+        std::cerr << "Failed to write " << options.output << "\n";
+        return -1;
+    }
+    return 0;
+}
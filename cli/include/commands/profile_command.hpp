@@ -0,0 +1,58 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_CLI_PROFILE_COMMAND_HPP
+#define BREEZY_CLI_PROFILE_COMMAND_HPP
+
+#include "commands/command_base.hpp"
+
+namespace breezy::cli {
+    /*
+    ============================
+    ProfileCommand
+
+    breezy profile [--rate HZ] [--engine tree|vm] [--output FILE] <script>
+
+    Runs a script under the runtime's sampling profiler (997 samples a second by
+    default). Writes the samples as collapsed stacks, one "frame;frame;... count"
+    line per distinct stack, to FILE (breezy.folded by default), ready for
+    flamegraph.pl or speedscope, and prints a per-line hit table to stderr.
+
+    Stacks are script;line N;native while executing and script;[phase] before.
+    ============================
+    */
+
+    class ProfileCommand : public CommandBase {
+        std::string name() const override;
+
+        int execute(const std::vector<std::string>& args) const override;
+    };
+}
+
+#endif // !BREEZY_CLI_PROFILE_COMMAND_HPP
@@ -0,0 +1,78 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_CLI_WORK_STEALING_POOL_HPP
+#define BREEZY_CLI_WORK_STEALING_POOL_HPP
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace breezy::cli {
+    /*
+    ============================
+    WorkStealingPool
+
+    Runs a batch of independent tasks, identified by index, on a fixed number of
+    threads. Indices are dealt round-robin into one deque per worker; a worker takes
+    the lowest index from the front of its own deque and, once that is empty, steals
+    the highest from the back of another's. Workers therefore move through the batch
+    roughly in order, and a few slow tasks never leave the other threads idle.
+    ============================
+    */
+
+    class WorkStealingPool {
+    public:
+        // 0 means one thread per hardware thread.
+        explicit WorkStealingPool(std::size_t threads);
+
+        std::size_t size() const { return workers_.size(); }
+
+        // Calls task(i) for every i in [0, count), using the calling thread as one of
+        // the workers, and returns once all calls have finished. Tasks must not throw.
+        void run(std::size_t count, const std::function<void(std::size_t)>& task);
+
+    private:
+        struct Worker {
+            std::mutex mutex;
+            std::deque<std::size_t> tasks;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers_;
+
+        void work(std::size_t self, const std::function<void(std::size_t)>& task);
+        bool take(std::size_t self, std::size_t& index);
+        bool steal(std::size_t self, std::size_t& index);
+    };
+}
+
+#endif // !BREEZY_CLI_WORK_STEALING_POOL_HPP
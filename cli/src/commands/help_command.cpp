@@ -37,8 +37,37 @@ namespace breezy::cli {
     }
 
     int HelpCommand::execute(const std::vector<std::string>& args) const {
-        std::cout << "Usage: breezy <command> [arguements]" << std::endl;
+        std::cout << "Usage: breezy <command> [arguments]" << std::endl;
         std::cout << "Example: breezy --help|-h" << std::endl;
+        std::cout << "\n"
+                  << "Commands:\n"
+                  << "  --version|-v                  Print the version\n"
+                  << "  --help|-h                     Print this help\n"
+                  << "  --run|-r [options] <script>   Run a script file\n"
+                  << "  --run|-r [options] <script|dir>...\n"
+                  << "                                Run several scripts in parallel; a directory stands for\n"
+                  << "                                every .bz file below it\n"
+                  << "  --run|-r [options] -s \"<code>\"\n"
+                  << "                                Run a snippet of code\n"
+                  << "  serve --socket PATH [--jobs N | --prefork N] [--engine tree|vm] [--cache]\n"
+                  << "                                Keep warm runtimes behind a Unix domain socket and run\n"
+                  << "                                the scripts clients send; N threads, or N forked\n"
+                  << "                                processes with --prefork (POSIX only)\n"
+                  << "  profile [--rate HZ] [--engine tree|vm] [--output FILE] <script>\n"
+                  << "                                Sample a run of <script>, print its hottest lines and\n"
+                  << "                                write collapsed stacks for flame graphs to FILE\n"
+                  << "                                (default: breezy.folded); HZ is 1 to 100000 (default: 997)\n"
+                  << "\n"
+                  << "Run options:\n"
+                  << "  --engine tree|vm              Execution engine (default: vm)\n"
+                  << "  -O0|-O1                       Optimization level (default: -O1)\n"
+                  << "  --jobs N                      Threads for several scripts (default: one per core)\n"
+                  << "  --cache                       Reuse compiled scripts from $XDG_CACHE_HOME/breezy or\n"
+                  << "                                ~/.cache/breezy; off by default, entries are never evicted\n"
+                  << "  --stats[=json]                Print runtime statistics to stderr\n"
+                  << "  --trace FILE                  Write a Chrome trace of the run to FILE\n"
+                  << "\n"
+                  << "run exits with 1 if any script fails.\n";
         return 0;
     }
 }
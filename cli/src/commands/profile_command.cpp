@@ -0,0 +1,227 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "commands/profile_command.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "breezy_runtime_interface.h"
+
+namespace breezy::cli {
+    namespace {
+        constexpr unsigned default_rate = 997; // prime, so sampling does not beat with periodic work
+        constexpr unsigned max_rate = 100000;  // what breezy_runtime_set_profiling accepts
+        constexpr std::size_t table_rows = 20;
+
+        struct ProfileOptions {
+            unsigned rate = default_rate;
+            breezy_engine engine = BREEZY_ENGINE_BYTECODE;
+            std::string output = "breezy.folded";
+            std::string script;
+        };
+
+        int usage() {
+            std::cerr << "Usage:\n"
+                      << "  breezy profile [--rate HZ] [--engine tree|vm] [--output FILE] <script>\n";
+            return -3;
+        }
+
+        // Line N of the script (1-based), trimmed, for the hit table
+        std::vector<std::string> read_lines(const std::string& path) {
+            std::vector<std::string> lines;
+            std::ifstream file(path);
+            std::string line;
+            while (std::getline(file, line)) {
+                std::size_t first = line.find_first_not_of(" \t\r");
+                std::size_t last = line.find_last_not_of(" \t\r");
+                lines.push_back(first == std::string::npos ? "" : line.substr(first, last - first + 1));
+            }
+            return lines;
+        }
+
+        std::string stack_of(const breezy_profile_entry& entry) {
+            std::string stack = entry.script;
+            if (std::string(entry.phase) != "execute") {
+                return stack + ";[" + entry.phase + "]";
+            }
+            stack += entry.line ? ";line " + std::to_string(entry.line) : std::string(";[execute]");
+            if (entry.native) {
+                stack += ";";
+                stack += entry.native;
+            }
+            return stack;
+        }
+
+        bool write_folded(const std::string& path, const breezy_profile_entry* entries, std::size_t count) {
+            std::ofstream out(path, std::ios::out | std::ios::trunc);
+            if (!out) {
+                return false;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                out << stack_of(entries[i]) << " " << entries[i].samples << "\n";
+            }
+            return static_cast<bool>(out);
+        }
+
+        void print_table(const ProfileOptions& options, const breezy_profile_entry* entries, std::size_t count) {
+            // Per line, with the natives called from it; phases before execution get a row each
+            struct Row {
+                std::uint64_t samples = 0;
+                std::uint64_t in_natives = 0;
+            };
+            std::map<std::string, Row> phases;
+            std::map<std::uint32_t, Row> lines;
+            std::uint64_t total = 0;
+
+            for (std::size_t i = 0; i < count; ++i) {
+                const breezy_profile_entry& entry = entries[i];
+                total += entry.samples;
+                Row& row = std::string(entry.phase) == "execute" && entry.line
+                    ? lines[entry.line]
+                    : phases["[" + std::string(entry.phase) + "]"];
+                row.samples += entry.samples;
+                if (entry.native) row.in_natives += entry.samples;
+            }
+
+            if (total == 0) {
+                std::cerr << "No samples; the run was shorter than one sampling interval (try a higher --rate)\n";
+                return;
+            }
+
+            std::vector<std::pair<std::uint32_t, Row>> hot(lines.begin(), lines.end());
+            std::sort(hot.begin(), hot.end(), [](const auto& a, const auto& b) {
+                return a.second.samples != b.second.samples ? a.second.samples > b.second.samples : a.first < b.first;
+            });
+
+            std::vector<std::string> source = read_lines(options.script);
+            char line[256];
+            std::snprintf(line, sizeof(line), "%llu samples at %u Hz\n", static_cast<unsigned long long>(total), options.rate);
+            std::cerr << line;
+            std::snprintf(line, sizeof(line), "%10s %7s %9s  %s\n", "samples", "%", "natives%", "line");
+            std::cerr << line;
+
+            auto print_row = [&](const std::string& label, const Row& row, const std::string& text) {
+                std::snprintf(line, sizeof(line), "%10llu %6.2f%% %8.2f%%  %-10s %.120s\n",
+                              static_cast<unsigned long long>(row.samples),
+                              100.0 * static_cast<double>(row.samples) / static_cast<double>(total),
+                              100.0 * static_cast<double>(row.in_natives) / static_cast<double>(row.samples),
+                              label.c_str(), text.c_str());
+                std::cerr << line;
+            };
+
+            for (const auto& [phase, row] : phases) {
+                print_row(phase, row, "");
+            }
+            for (std::size_t i = 0; i < hot.size() && i < table_rows; ++i) {
+                std::uint32_t number = hot[i].first;
+                print_row(std::to_string(number), hot[i].second, number <= source.size() ? source[number - 1] : "");
+            }
+            if (hot.size() > table_rows) {
+                std::cerr << "  ... " << hot.size() - table_rows << " more line(s) in the folded output\n";
+            }
+        }
+    }
+
+    std::string ProfileCommand::name() const {
+        return "profile";
+    }
+
+    int ProfileCommand::execute(const std::vector<std::string>& args) const {
+        ProfileOptions options;
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            const std::string& option = args[i];
+            if (option.rfind("--", 0) != 0) {
+                if (!options.script.empty()) return usage();
+                options.script = option;
+                continue;
+            }
+
+            if (i + 1 >= args.size()) {
+                return usage();
+            }
+            const std::string& value = args[++i];
+
+            if (option == "--rate") {
+                if (value.empty() || value.size() > 6 || value.find_first_not_of("0123456789") != std::string::npos
+                    || std::stoul(value) == 0 || std::stoul(value) > max_rate) {
+                    std::cerr << "Invalid sampling rate: " << value << " (expected 1 to " << max_rate
+                              << " samples a second)\n";
+                    return -3;
+                }
+                options.rate = static_cast<unsigned>(std::stoul(value));
+            }
+            else if (option == "--engine" && (value == "tree" || value == "vm")) {
+                options.engine = value == "tree" ? BREEZY_ENGINE_TREE_WALK : BREEZY_ENGINE_BYTECODE;
+            }
+            else if (option == "--output") {
+                options.output = value;
+            }
+            else {
+                return usage();
+            }
+        }
+        if (options.script.empty()) {
+            return usage();
+        }
+
+        breezy_runtime* runtime = breezy_runtime_create();
+        if (!runtime) {
+            std::cerr << "Failed to create the runtime\n";
+            return -1;
+        }
+
+        // No program cache, so the profile covers the frontend phases too
+        breezy_runtime_set_engine(runtime, options.engine);
+        breezy_runtime_set_profiling(runtime, options.rate);
+        int status = breezy_runtime_run_file(runtime, options.script.c_str());
+
+        const breezy_profile_entry* entries = nullptr;
+        std::size_t count = breezy_runtime_get_profile(runtime, &entries);
+
+        int result = status == 0 ? 0 : 1;
+        if (write_folded(options.output, entries, count)) {
+            std::cerr << "Wrote collapsed stacks to " << options.output << "\n";
+        }
+        else {
+            std::cerr << "Failed to write " << options.output << "\n";
+            result = -1;
+        }
+        print_table(options, entries, count);
+
+        breezy_runtime_destroy(runtime);
+        return result;
+    }
+}
@@ -29,43 +29,482 @@
 
 #include "commands/run_command.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "breezy_runtime_interface.h"
+#include "services/work_stealing_pool.hpp"
+
+namespace breezy::cli {
+    namespace {
+        enum class StatsFormat {
+            None,
+            Text,   // --stats
+            Json    // --stats=json
+        };
+
+        struct RunOptions {
+            breezy_engine engine = BREEZY_ENGINE_BYTECODE;
+            int optimization = 1;   // -O0 / -O1
+            bool use_cache = false; // --cache; opt-in, entries are never evicted
+            bool batch = false;     // set by --jobs
+            std::size_t jobs = 0;   // 0: one per hardware thread
+            StatsFormat stats = StatsFormat::None;
+            std::string trace_path;     // --trace FILE
+        };
+
+        // Spans kept from each runtime, which must be copied out before it is destroyed
+        struct TraceRecord {
+            std::string name;
+            const char* category;
+            std::uint64_t start_ns;
+            std::uint64_t duration_ns;
+            std::uint64_t thread;
+            std::uint32_t line;
+        };
+
+        /* ==== Statistics ==== */
+
+        // Which engines maintain a counter; the others would only ever report 0 for it
+        enum CountedBy : unsigned {
+            TreeWalkOnly = 1u << BREEZY_ENGINE_TREE_WALK,
+            BytecodeOnly = 1u << BREEZY_ENGINE_BYTECODE,
+            BothEngines = TreeWalkOnly | BytecodeOnly
+        };
+
+        struct CounterField {
+            const char* name;
+            std::uint64_t breezy_stats::* field;
+            unsigned engines = BothEngines;
+        };
+
+        struct TimerField {
+            const char* name;
+            double breezy_stats::* field;
+        };
+
+        constexpr CounterField counter_fields[] = {
+            { "bytes_lexed",           &breezy_stats::bytes_lexed },
+            { "tokens_lexed",          &breezy_stats::tokens_lexed },
+            { "ast_nodes",             &breezy_stats::ast_nodes },
+            { "statements_executed",   &breezy_stats::statements_executed, TreeWalkOnly },
+            { "instructions_executed", &breezy_stats::instructions_executed, BytecodeOnly },
+            { "variable_lookups",      &breezy_stats::variable_lookups, TreeWalkOnly },
+            { "native_calls",          &breezy_stats::native_calls },
+            { "allocations",           &breezy_stats::allocations },
+            { "allocated_bytes",       &breezy_stats::allocated_bytes }
+        };
+
+        constexpr TimerField timer_fields[] = {
+            { "parse",    &breezy_stats::parse_seconds },
+            { "resolve",  &breezy_stats::resolve_seconds },
+            { "optimize", &breezy_stats::optimize_seconds },
+            { "compile",  &breezy_stats::compile_seconds },
+            { "load",     &breezy_stats::load_seconds },
+            { "execute",  &breezy_stats::execute_seconds }
+        };
+
+        void add_stats(breezy_stats& total, const breezy_stats& stats) {
+            for (const CounterField& counter : counter_fields) total.*counter.field += stats.*counter.field;
+            for (const TimerField& timer : timer_fields) total.*timer.field += stats.*timer.field;
+        }
+
+        // Written to stderr so the script's own output stays clean. Counters `engine`
+        // does not maintain are left out.
+        void print_stats(const breezy_stats& stats, StatsFormat format, breezy_engine engine) {
+            const unsigned counted = 1u << engine;
+            char line[128];
+            if (format == StatsFormat::Json) {
+                std::cerr << "{";
+                const char* separator = "";
+                for (const CounterField& counter : counter_fields) {
+                    if (!(counter.engines & counted)) continue;
+                    std::snprintf(line, sizeof(line), "%s\"%s\": %llu", separator, counter.name,
+                                  static_cast<unsigned long long>(stats.*counter.field));
+                    std::cerr << line;
+                    separator = ", ";
+                }
+                for (const TimerField& timer : timer_fields) {
+                    std::snprintf(line, sizeof(line), ", \"%s_seconds\": %.9f", timer.name, stats.*timer.field);
+                    std::cerr << line;
+                }
+                std::cerr << "}\n";
+                return;
+            }
+
+            std::cerr << "-- stats --\n";
+            for (const CounterField& counter : counter_fields) {
+                if (!(counter.engines & counted)) continue;
+                std::snprintf(line, sizeof(line), "%-22s %llu\n", counter.name,
+                              static_cast<unsigned long long>(stats.*counter.field));
+                std::cerr << line;
+            }
+            for (const TimerField& timer : timer_fields) {
+                std::snprintf(line, sizeof(line), "%-22s %.3f ms\n", (std::string(timer.name) + "_time").c_str(),
+                              stats.*timer.field * 1000.0);
+                std::cerr << line;
+            }
+        }
+
+        /* ==== Tracing ==== */
+
+        constexpr std::size_t trace_capacity = 1u << 20; // spans kept per runtime
+
+        std::uint64_t trace_clock() {
+            // The runtime stamps its spans with the same clock
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // Copies the runtime's spans out, plus one for the whole script run since `start`
+        void collect_trace(breezy_runtime* runtime, const std::string& script, std::uint64_t start,
+                           std::vector<TraceRecord>& out) {
+            const breezy_trace_event* events = nullptr;
+            std::size_t count = breezy_runtime_get_trace(runtime, &events);
+
+            std::uint64_t thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+            out.push_back({ script, "script", start, trace_clock() - start, thread, 0 });
+            for (std::size_t i = 0; i < count; ++i) {
+                const breezy_trace_event& event = events[i];
+                out.push_back({ std::string(event.name, event.name_size), event.category,
+                                event.start_ns, event.duration_ns, event.thread, event.line });
+            }
+        }
+
+        void write_json_string(std::ostream& out, const std::string& text) {
+            out << '"';
+            for (char c : text) {
+                if (c == '"' || c == '\\') {
+                    out << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    out << escaped;
+                }
+                else {
+                    out << c;
+                }
+            }
+            out << '"';
+        }
+
+        // Chrome trace-event format: complete ("X") events, timestamps in microseconds
+        // from the first span, threads numbered in order of first appearance.
+        bool write_trace(const std::string& path, std::vector<TraceRecord>& records) {
+            std::ofstream out(path, std::ios::out | std::ios::trunc);
+            if (!out) {
+                std::cerr << "Failed to write trace: " << path << "\n";
+                return false;
+            }
+
+            std::stable_sort(records.begin(), records.end(), [](const TraceRecord& a, const TraceRecord& b) {
+                return a.start_ns < b.start_ns;
+            });
+            std::uint64_t origin = records.empty() ? 0 : records.front().start_ns;
+
+            std::vector<std::uint64_t> threads;
+            auto tid_of = [&](std::uint64_t thread) {
+                auto it = std::find(threads.begin(), threads.end(), thread);
+                if (it == threads.end()) {
+                    threads.push_back(thread);
+                    return threads.size();
+                }
+                return static_cast<std::size_t>(it - threads.begin()) + 1;
+            };
+
+            out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+            out << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"breezy\"}}";
+            char numbers[128];
+            for (const TraceRecord& record : records) {
+                out << ",\n{\"name\": ";
+                write_json_string(out, record.name);
+                std::snprintf(numbers, sizeof(numbers), ", \"cat\": \"%s\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": %zu",
+                              record.category, static_cast<double>(record.start_ns - origin) / 1000.0,
+                              static_cast<double>(record.duration_ns) / 1000.0, tid_of(record.thread));
+                out << numbers;
+                if (record.line) {
+                    out << ", \"args\": {\"line\": " << record.line << "}";
+                }
+                out << "}";
+            }
+            for (std::size_t i = 0; i < threads.size(); ++i) {
+                out << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << i + 1
+                    << ", \"args\": {\"name\": \"runtime thread " << i + 1 << "\"}}";
+            }
+            out << "\n]}\n";
+
+            if (!out) {
+                std::cerr << "Failed to write trace: " << path << "\n";
+                return false;
+            }
+            std::cerr << "Wrote " << records.size() << " trace event(s) to " << path << "\n";
+            return true;
+        }
+
+        void report_stats(const breezy_runtime* runtime, const RunOptions& options) {
+            if (options.stats == StatsFormat::None) {
+                return;
+            }
+            breezy_stats stats;
+            if (breezy_runtime_get_stats(runtime, &stats) != 0) {
+                std::cerr << "Statistics are unavailable: the runtime was built without BREEZY_ENABLE_STATS\n";
+                return;
+            }
+            print_stats(stats, options.stats, options.engine);
+        }
+
+        // One script's output and outcome, held until every script before it has
+        // been written out.
+        struct ScriptResult {
+            std::string out;
+            std::string err;
+            bool ok = false;
+            bool done = false;
+            double milliseconds = 0.0;
+            breezy_stats stats{};
+            bool has_stats = false;
+            std::vector<TraceRecord> trace;
+        };
+
+        void capture_output(breezy_stream stream, const char* data, size_t size, void* user_data) {
+            auto* result = static_cast<ScriptResult*>(user_data);
+            (stream == BREEZY_STREAM_STDERR ? result->err : result->out).append(data, size);
+        }
+
+        // Directories stand for every .bz file below them, in path order.
+        std::vector<std::filesystem::path> collect_scripts(const std::vector<std::string>& args) {
+            std::vector<std::filesystem::path> scripts;
+            for (const std::string& arg : args) {
+                std::error_code error;
+                if (!std::filesystem::is_directory(arg, error)) {
+                    scripts.emplace_back(arg); // missing files are reported by the runtime
+                    continue;
+                }
+
+                std::vector<std::filesystem::path> found;
+                for (const auto& entry : std::filesystem::recursive_directory_iterator(arg, error)) {
+                    if (entry.is_regular_file(error) && entry.path().extension() == ".bz") {
+                        found.push_back(entry.path());
+                    }
+                }
+                std::sort(found.begin(), found.end());
+                scripts.insert(scripts.end(), found.begin(), found.end());
+            }
+            return scripts;
+        }
+
+        void emit(const std::filesystem::path& script, const ScriptResult& result) {
+            std::cout << result.out << std::flush;
+            std::cerr << result.err;
+
+            char line[64];
+            std::snprintf(line, sizeof(line), "%.2f ms", result.milliseconds);
+            std::cerr << (result.ok ? "[ok]   " : "[fail] ") << script.string() << " (" << line << ")\n";
+        }
+
+        int run_batch(const std::vector<std::filesystem::path>& scripts, const RunOptions& options) {
+            using Clock = std::chrono::steady_clock;
+
+            WorkStealingPool pool(options.jobs);
+            std::vector<ScriptResult> results(scripts.size());
+            std::mutex emit_mutex;
+            std::size_t next = 0;     // first script not yet written out
+            std::size_t failed = 0;
+            breezy_stats total_stats{};
+            bool has_stats = options.stats != StatsFormat::None;
+
+            Clock::time_point batch_start = Clock::now();
+            pool.run(scripts.size(), [&](std::size_t i) {
+                ScriptResult& result = results[i];
+                Clock::time_point start = Clock::now();
+
+                // Every script gets its own isolate; nothing leaks from one to the next
+                if (breezy_runtime* runtime = breezy_runtime_create()) {
+                    std::uint64_t trace_start = trace_clock();
+                    breezy_runtime_set_engine(runtime, options.engine);
+                    breezy_runtime_set_optimization(runtime, options.optimization);
+                    breezy_runtime_set_cache(runtime, options.use_cache, nullptr);
+                    breezy_runtime_set_output(runtime, capture_output, &result);
+                    if (!options.trace_path.empty()) breezy_runtime_set_tracing(runtime, trace_capacity);
+                    result.ok = breezy_runtime_run_file(runtime, scripts[i].string().c_str()) == 0;
+                    result.has_stats = breezy_runtime_get_stats(runtime, &result.stats) == 0;
+                    if (!options.trace_path.empty()) collect_trace(runtime, scripts[i].string(), trace_start, result.trace);
+                    breezy_runtime_destroy(runtime);
+                }
+                else {
+                    result.err = "Failed to create the runtime\n";
+                }
+                result.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+                // Whoever completes the next script in order writes out every finished
+                // script from there on
+                std::lock_guard<std::mutex> lock(emit_mutex);
+                result.done = true;
+                while (next < results.size() && results[next].done) {
+                    ScriptResult& finished = results[next++];
+                    emit(scripts[next - 1], finished);
+                    if (!finished.ok) ++failed;
+                    if (finished.has_stats) add_stats(total_stats, finished.stats);
+                    else has_stats = false;
+                    std::string().swap(finished.out);
+                    std::string().swap(finished.err);
+                }
+            });
+            double total = std::chrono::duration<double, std::milli>(Clock::now() - batch_start).count();
+
+            char line[128];
+            std::snprintf(line, sizeof(line), "%zu script(s), %zu failed, %.2f ms on %zu thread(s)",
+                          scripts.size(), failed, total, pool.size());
+            std::cerr << line << "\n";
+
+            if (options.stats != StatsFormat::None) {
+                if (has_stats) print_stats(total_stats, options.stats, options.engine);
+                else std::cerr << "Statistics are unavailable: the runtime was built without BREEZY_ENABLE_STATS\n";
+            }
+
+            if (!options.trace_path.empty()) {
+                std::vector<TraceRecord> trace;
+                for (ScriptResult& result : results) {
+                    trace.insert(trace.end(), std::make_move_iterator(result.trace.begin()),
+                                 std::make_move_iterator(result.trace.end()));
+                }
+                write_trace(options.trace_path, trace);
+            }
+            return failed == 0 ? 0 : 1;
+        }
+    }
 
-namespace breezy::cli {         
     std::string RunCommand::name() const {
         return "run";
     }
 
     int RunCommand::execute(const std::vector<std::string>& args) const {
+        // Leading options: --engine tree|vm, -O0|-O1, --cache, --jobs N, --stats[=json], --trace FILE
+        RunOptions options;
+        std::size_t first = 0;
+        while (first < args.size()) {
+            const std::string& option = args[first];
+            if (option == "--cache") {
+                options.use_cache = true;
+                first += 1;
+                continue;
+            }
+            if (option == "-O0" || option == "-O1") {
+                options.optimization = option[2] - '0';
+                first += 1;
+                continue;
+            }
+            if (option == "--stats" || option == "--stats=text" || option == "--stats=json") {
+                options.stats = option == "--stats=json" ? StatsFormat::Json : StatsFormat::Text;
+                first += 1;
+                continue;
+            }
+            if ((option != "--engine" && option != "--jobs" && option != "--trace") || first + 1 >= args.size()) {
+                break;
+            }
+
+            const std::string& value = args[first + 1];
+            if (option == "--trace") {
+                options.trace_path = value;
+            }
+            else if (option == "--jobs") {
+                if (value.empty() || value.size() > 6 || value.find_first_not_of("0123456789") != std::string::npos) {
+                    std::cerr << "Invalid job count: " << value << " (expected a number, 0 for one per core)\n";
+                    return -3;
+                }
+                options.batch = true;
+                options.jobs = static_cast<std::size_t>(std::stoul(value));
+            }
+            else if (value == "tree") {
+                options.engine = BREEZY_ENGINE_TREE_WALK;
+            }
+            else if (value == "vm") {
+                options.engine = BREEZY_ENGINE_BYTECODE;
+            }
+            else {
+                std::cerr << "Unknown engine: " << value << " (expected 'tree' or 'vm')\n";
+                return -3;
+            }
+            first += 2;
+        }
+        std::vector<std::string> rest(args.begin() + first, args.end());
+
         // Case 1: inline string (breezy --run -s "code")
-        if (args.size() >= 2 && args[0] == "-s") {
-            const std::string& code = args[1];
+        if (rest.size() >= 2 && rest[0] == "-s") {
+            const std::string& code = rest[1];
+
+            breezy_runtime* runtime = breezy_runtime_create();
+            if (!runtime) {
+                std::cerr << "Failed to create the runtime\n";
+                return -1;
+            }
+            std::uint64_t trace_start = trace_clock();
+            breezy_runtime_set_engine(runtime, options.engine);
+            breezy_runtime_set_optimization(runtime, options.optimization);
+            if (!options.trace_path.empty()) breezy_runtime_set_tracing(runtime, trace_capacity);
+            bool ok = breezy_runtime_run_string(runtime, code.c_str()) == 0;
+            report_stats(runtime, options);
 
-            breezy_runtime_init();
-            breezy_runtime_run_string(code.c_str());
-            breezy_runtime_shutdown();
+            if (!options.trace_path.empty()) {
+                std::vector<TraceRecord> trace;
+                collect_trace(runtime, "<string>", trace_start, trace);
+                write_trace(options.trace_path, trace);
+            }
+            breezy_runtime_destroy(runtime);
 
-            return 0;
+            return ok ? 0 : 1;
         }
 
-        // Case 2: script file (breezy --run myscript.bz)
-        if (args.size() >= 1) {
-            const std::string& filename = args[0];
+        // Case 2: several scripts or directories, or --jobs (breezy --run --jobs 8 a.bz dir/)
+        std::error_code error;
+        if (!rest.empty() && (options.batch || rest.size() > 1 || std::filesystem::is_directory(rest[0], error))) {
+            return run_batch(collect_scripts(rest), options);
+        }
+
+        // Case 3: script file (breezy --run myscript.bz)
+        if (rest.size() >= 1) {
+            const std::string& filename = rest[0];
+
+            breezy_runtime* runtime = breezy_runtime_create();
+            if (!runtime) {
+                std::cerr << "Failed to create the runtime\n";
+                return -1;
+            }
+            std::uint64_t trace_start = trace_clock();
+            breezy_runtime_set_engine(runtime, options.engine);
+            breezy_runtime_set_optimization(runtime, options.optimization);
+            breezy_runtime_set_cache(runtime, options.use_cache, nullptr);
+            if (!options.trace_path.empty()) breezy_runtime_set_tracing(runtime, trace_capacity);
+            bool ok = breezy_runtime_run_file(runtime, filename.c_str()) == 0;
+            report_stats(runtime, options);
 
-            breezy_runtime_init();
-            breezy_runtime_run_file(filename.c_str());
-            breezy_runtime_shutdown();
+            if (!options.trace_path.empty()) {
+                std::vector<TraceRecord> trace;
+                collect_trace(runtime, filename, trace_start, trace);
+                write_trace(options.trace_path, trace);
+            }
+            breezy_runtime_destroy(runtime);
 
-            return 0;
+            return ok ? 0 : 1;
         }
 
         // No valid arguments
         std::cerr << "Usage:\n"
-                  << "  breezy --run|-r -s \"<code>\"\n"
-                  << "  breezy --run|-r <scriptfile>\n";
+                  << "  breezy --run|-r [--engine tree|vm] [-O0|-O1] [--stats[=json]] [--trace FILE] -s \"<code>\"\n"
+                  << "  breezy --run|-r [--engine tree|vm] [-O0|-O1] [--cache] [--stats[=json]] [--trace FILE] <scriptfile>\n"
+                  << "  breezy --run|-r [--engine tree|vm] [-O0|-O1] [--cache] [--stats[=json]] [--trace FILE] [--jobs N] <script|dir>...\n";
         return -3;
     }
 }
\ No newline at end of file
@@ -0,0 +1,586 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "commands/serve_command.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "breezy_runtime_interface.h"
+
+#ifndef _WIN32
+#  include <algorithm>
+#  include <cerrno>
+#  include <condition_variable>
+#  include <csignal>
+#  include <cstring>
+#  include <deque>
+#  include <mutex>
+#  include <thread>
+#  include <unordered_set>
+#  include <vector>
+
+#  include <fcntl.h>
+#  include <poll.h>
+#  include <pthread.h>
+#  include <sys/socket.h>
+#  include <sys/un.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+#endif
+
+namespace breezy::cli {
+#ifndef _WIN32
+    namespace {
+        constexpr std::size_t max_request_line = 4096;
+        constexpr std::size_t max_source_size = 64u << 20;
+
+        struct ServeOptions {
+            std::string socket_path;
+            breezy_engine engine = BREEZY_ENGINE_BYTECODE;
+            bool use_cache = false;    // --cache; opt-in, entries are never evicted
+            std::size_t jobs = 0;      // threads; 0 for one per core
+            std::size_t prefork = 0;   // processes; 0 to serve from threads instead
+        };
+
+        // Set from SIGINT / SIGTERM. Every handled signal also writes a byte to
+        // wake_pipe, which the accept and reaping loops poll: a signal that lands just
+        // before they block still wakes them.
+        volatile std::sig_atomic_t stop_requested = 0;
+        int wake_pipe[2] = { -1, -1 };
+
+        void wake() {
+            int saved = errno;
+            char byte = 0;
+            [[maybe_unused]] ssize_t written = ::write(wake_pipe[1], &byte, 1);
+            errno = saved;
+        }
+
+        void on_stop_signal(int) {
+            stop_requested = 1;
+            wake();
+        }
+
+        void on_child_signal(int) {
+            wake();
+        }
+
+        bool open_wake_pipe() {
+            if (::pipe(wake_pipe) != 0) return false;
+            for (int fd : wake_pipe) {
+                ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+                ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+            }
+            return true;
+        }
+
+        // Blocks until `fd` is readable, a signal arrives or `timeout_ms` passes (-1:
+        // no timeout); fd -1 waits for signals only. Returns true if `fd` is readable.
+        bool wait_readable(int fd, int timeout_ms) {
+            pollfd fds[2] = { { wake_pipe[0], POLLIN, 0 }, { fd, POLLIN, 0 } };
+            if (::poll(fds, fd >= 0 ? 2 : 1, timeout_ms) <= 0) {
+                return false;
+            }
+            if (fds[0].revents & POLLIN) {
+                char drained[64];
+                while (::read(wake_pipe[0], drained, sizeof(drained)) > 0) {}
+            }
+            return fd >= 0 && (fds[1].revents & POLLIN);
+        }
+
+        bool parse_count(const std::string& text, std::size_t limit, std::size_t& out) {
+            if (text.empty() || text.size() > 20 || text.find_first_not_of("0123456789") != std::string::npos) {
+                return false;
+            }
+            unsigned long long value = std::stoull(text);
+            if (value > limit) {
+                return false;
+            }
+            out = static_cast<std::size_t>(value);
+            return true;
+        }
+
+        /* ==== Connection ==== */
+
+        // One client: buffered reads of requests and framed writes of results. After
+        // a failed write the connection is broken and further frames are dropped.
+        class Connection {
+        public:
+            explicit Connection(int fd) : fd_(fd) {}
+
+            bool broken() const { return broken_; }
+
+            // Reads up to '\n', which is not stored. Fails on EOF or an over-long line.
+            bool read_line(std::string& line) {
+                line.clear();
+                for (;;) {
+                    if (begin_ == end_ && !fill()) return false;
+
+                    const char* start = buffer_ + begin_;
+                    const void* newline = std::memchr(start, '\n', end_ - begin_);
+                    std::size_t take = newline ? static_cast<const char*>(newline) - start : end_ - begin_;
+                    line.append(start, take);
+                    begin_ += take;
+
+                    if (line.size() > max_request_line) return false;
+                    if (newline) {
+                        ++begin_;
+                        return true;
+                    }
+                }
+            }
+
+            bool read_exact(std::string& out, std::size_t size) {
+                out.clear();
+                out.reserve(size);
+                while (out.size() < size) {
+                    if (begin_ == end_ && !fill()) return false;
+                    std::size_t take = std::min(end_ - begin_, size - out.size());
+                    out.append(buffer_ + begin_, take);
+                    begin_ += take;
+                }
+                return true;
+            }
+
+            void send_frame(char kind, const char* data, std::size_t size) {
+                std::string header = std::string(1, kind) + " " + std::to_string(size) + "\n";
+                write_all(header.data(), header.size()) && write_all(data, size);
+            }
+
+            void send_status(int status) {
+                std::string line = "X " + std::to_string(status) + "\n";
+                write_all(line.data(), line.size());
+            }
+
+        private:
+            int fd_;
+            char buffer_[4096];
+            std::size_t begin_ = 0;
+            std::size_t end_ = 0;
+            bool broken_ = false;
+
+            bool fill() {
+                for (;;) {
+                    ssize_t count = ::read(fd_, buffer_, sizeof(buffer_));
+                    if (count > 0) {
+                        begin_ = 0;
+                        end_ = static_cast<std::size_t>(count);
+                        return true;
+                    }
+                    if (count < 0 && errno == EINTR) continue;
+                    return false;
+                }
+            }
+
+            bool write_all(const char* data, std::size_t size) {
+                while (!broken_ && size > 0) {
+                    ssize_t count = ::write(fd_, data, size);
+                    if (count < 0) {
+                        if (errno == EINTR) continue;
+                        broken_ = true;
+                        break;
+                    }
+                    data += count;
+                    size -= static_cast<std::size_t>(count);
+                }
+                return !broken_;
+            }
+        };
+
+        void forward_frame(breezy_stream stream, const char* data, size_t size, void* user_data) {
+            static_cast<Connection*>(user_data)->send_frame(stream == BREEZY_STREAM_STDERR ? 'E' : 'O', data, size);
+        }
+
+        breezy_runtime* create_runtime(const ServeOptions& options) {
+            breezy_runtime* runtime = breezy_runtime_create();
+            if (runtime) {
+                breezy_runtime_set_engine(runtime, options.engine);
+                breezy_runtime_set_cache(runtime, options.use_cache, nullptr);
+            }
+            return runtime;
+        }
+
+        // Answers requests until the client hangs up or sends a bad request, then
+        // closes `fd`. The runtime is reset after every request.
+        void serve_connection(breezy_runtime* runtime, int fd) {
+            Connection connection(fd);
+            breezy_runtime_set_output(runtime, forward_frame, &connection);
+
+            std::string line;
+            std::string source;
+            std::size_t size = 0;
+            while (!connection.broken() && connection.read_line(line)) {
+                int status;
+                if (line.compare(0, 4, "RUN ") == 0 && line.size() > 4) {
+                    status = breezy_runtime_run_file(runtime, line.c_str() + 4) == 0 ? 0 : 1;
+                }
+                else if (line.compare(0, 5, "EVAL ") == 0
+                         && parse_count(line.substr(5), max_source_size, size)
+                         && connection.read_exact(source, size)) {
+                    status = breezy_runtime_run_string(runtime, source.c_str()) == 0 ? 0 : 1;
+                }
+                else {
+                    static const char message[] = "Bad request\n";
+                    connection.send_frame('E', message, sizeof(message) - 1);
+                    connection.send_status(2);
+                    break;
+                }
+
+                breezy_runtime_reset(runtime);
+                connection.send_status(status);
+            }
+
+            breezy_runtime_set_output(runtime, nullptr, nullptr);
+            ::close(fd);
+        }
+
+        /* ==== Listening socket ==== */
+
+        int open_listener(const std::string& path) {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+                std::cerr << "Socket path is empty or too long: " << path << "\n";
+                return -1;
+            }
+            std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+            int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0) {
+                std::cerr << "socket() failed: " << std::strerror(errno) << "\n";
+                return -1;
+            }
+            ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+            // A socket file left by a server that died is replaced; a live one is not
+            if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+                std::cerr << "Another server is already listening on " << path << "\n";
+                ::close(fd);
+                return -1;
+            }
+            if (errno == ECONNREFUSED) {
+                ::unlink(path.c_str());
+            }
+
+            ::close(fd);
+            fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0
+                || ::fcntl(fd, F_SETFD, FD_CLOEXEC) != 0
+                || ::bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+                || ::listen(fd, SOMAXCONN) != 0) {
+                std::cerr << "Cannot listen on " << path << ": " << std::strerror(errno) << "\n";
+                if (fd >= 0) ::close(fd);
+                return -1;
+            }
+            return fd;
+        }
+
+        int usage() {
+            std::cerr << "Usage:\n"
+                      << "  breezy serve --socket <path> [--jobs N | --prefork N] [--engine tree|vm] [--cache]\n";
+            return -3;
+        }
+
+        void install_signal_handlers() {
+            struct sigaction action{};
+            action.sa_handler = SIG_IGN;
+            ::sigaction(SIGPIPE, &action, nullptr); // a client that hangs up is just a broken connection
+
+            action.sa_handler = on_stop_signal;
+            sigemptyset(&action.sa_mask);
+            ::sigaction(SIGINT, &action, nullptr);
+            ::sigaction(SIGTERM, &action, nullptr);
+
+            // Wakes the prefork parent to replace a child that exited
+            action.sa_handler = on_child_signal;
+            action.sa_flags = SA_NOCLDSTOP;
+            ::sigaction(SIGCHLD, &action, nullptr);
+        }
+
+        /* ==== Threaded mode ==== */
+
+        // Accepted connections waiting for a worker, plus the ones being served so
+        // they can be shut down on exit.
+        class ConnectionQueue {
+        public:
+            void push(int fd) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                pending_.push_back(fd);
+                ready_.notify_one();
+            }
+
+            // Returns false once the queue is closed.
+            bool pop(int& fd) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this] { return closed_ || !pending_.empty(); });
+                if (closed_) return false;
+                fd = pending_.front();
+                pending_.pop_front();
+                active_.insert(fd);
+                return true;
+            }
+
+            void finished(int fd) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                active_.erase(fd);
+            }
+
+            // Wakes every worker and ends every open connection.
+            void close() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                closed_ = true;
+                for (int fd : pending_) ::close(fd);
+                pending_.clear();
+                for (int fd : active_) ::shutdown(fd, SHUT_RDWR);
+                ready_.notify_all();
+            }
+
+        private:
+            std::mutex mutex_;
+            std::condition_variable ready_;
+            std::deque<int> pending_;
+            std::unordered_set<int> active_;
+            bool closed_ = false;
+        };
+
+        int serve_threads(int listener, const ServeOptions& options) {
+            std::size_t count = options.jobs ? options.jobs : std::thread::hardware_concurrency();
+            if (count == 0) count = 1;
+
+            // Created up front so a runtime that cannot be allocated fails startup
+            // instead of leaving a worker that drops every connection it takes
+            std::vector<breezy_runtime*> runtimes;
+            for (std::size_t i = 0; i < count; ++i) {
+                breezy_runtime* runtime = create_runtime(options);
+                if (!runtime) {
+                    std::cerr << "Failed to create the runtime\n";
+                    for (breezy_runtime* created : runtimes) {
+                        breezy_runtime_destroy(created);
+                    }
+                    return -1;
+                }
+                runtimes.push_back(runtime);
+            }
+
+            ConnectionQueue queue;
+            std::vector<std::thread> workers;
+
+            // Workers never take the stop signals, so their socket I/O is never interrupted
+            sigset_t stop_signals;
+            sigset_t previous;
+            sigemptyset(&stop_signals);
+            sigaddset(&stop_signals, SIGINT);
+            sigaddset(&stop_signals, SIGTERM);
+            ::pthread_sigmask(SIG_BLOCK, &stop_signals, &previous);
+
+            for (breezy_runtime* runtime : runtimes) {
+                workers.emplace_back([&queue, runtime] {
+                    int fd;
+                    while (queue.pop(fd)) {
+                        serve_connection(runtime, fd);
+                        queue.finished(fd);
+                    }
+                    breezy_runtime_destroy(runtime);
+                });
+            }
+            ::pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+
+            // Non-blocking, so a client that hangs up between poll() and accept()
+            // cannot leave the loop stuck in accept()
+            ::fcntl(listener, F_SETFL, ::fcntl(listener, F_GETFL) | O_NONBLOCK);
+            while (!stop_requested) {
+                if (!wait_readable(listener, -1)) continue;
+
+                int fd = ::accept(listener, nullptr, nullptr);
+                if (fd >= 0) {
+                    // Some systems pass O_NONBLOCK on; connections use blocking I/O
+                    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+                    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+                    queue.push(fd);
+                }
+                else if (errno != EINTR && errno != ECONNABORTED && errno != EAGAIN && errno != EWOULDBLOCK) {
+                    std::cerr << "accept() failed: " << std::strerror(errno) << "\n";
+                    break;
+                }
+            }
+
+            queue.close();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            return 0;
+        }
+
+        /* ==== Prefork mode ==== */
+
+        [[noreturn]] void prefork_child(int listener, breezy_runtime* runtime) {
+            ::signal(SIGINT, SIG_DFL);
+            ::signal(SIGTERM, SIG_DFL);
+            ::signal(SIGCHLD, SIG_DFL);
+            ::close(wake_pipe[0]);
+            ::close(wake_pipe[1]);
+
+            for (;;) {
+                int fd = ::accept(listener, nullptr, nullptr);
+                if (fd >= 0) {
+                    serve_connection(runtime, fd);
+                }
+                else if (errno != EINTR && errno != ECONNABORTED) {
+                    ::_exit(1);
+                }
+            }
+        }
+
+        int serve_prefork(int listener, const ServeOptions& options) {
+            // Initialized once; every child starts from a copy-on-write image of it
+            breezy_runtime* runtime = create_runtime(options);
+            if (!runtime) {
+                std::cerr << "Failed to create the runtime\n";
+                return -1;
+            }
+
+            std::vector<pid_t> children(options.prefork, -1);
+            auto spawn = [&](std::size_t slot) {
+                pid_t pid = ::fork();
+                if (pid == 0) {
+                    prefork_child(listener, runtime);
+                }
+                children[slot] = pid;
+                if (pid < 0) {
+                    std::cerr << "fork() failed: " << std::strerror(errno) << "\n";
+                }
+            };
+            for (std::size_t i = 0; i < children.size(); ++i) {
+                spawn(i);
+            }
+
+            // Replace children that die until asked to stop. A slot whose fork()
+            // failed is retried every second.
+            while (!stop_requested) {
+                bool missing = std::find(children.begin(), children.end(), -1) != children.end();
+                wait_readable(-1, missing ? 1000 : -1);
+
+                pid_t pid;
+                while ((pid = ::waitpid(-1, nullptr, WNOHANG)) > 0) {
+                    std::replace(children.begin(), children.end(), pid, pid_t(-1));
+                }
+                if (stop_requested) break;
+
+                for (std::size_t i = 0; i < children.size(); ++i) {
+                    if (children[i] < 0) spawn(i);
+                }
+            }
+
+            for (pid_t pid : children) {
+                if (pid > 0) ::kill(pid, SIGTERM);
+            }
+            while (::waitpid(-1, nullptr, 0) > 0 || errno == EINTR) {}
+
+            breezy_runtime_destroy(runtime);
+            return 0;
+        }
+    }
+#endif
+
+    std::string ServeCommand::name() const {
+        return "serve";
+    }
+
+    int ServeCommand::execute(const std::vector<std::string>& args) const {
+#ifdef _WIN32
+        std::cerr << "serve needs Unix domain sockets and is not available on this platform\n";
+        return -1;
+#else
+        ServeOptions options;
+        bool has_jobs = false;
+        bool has_prefork = false;
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            const std::string& option = args[i];
+            if (option == "--cache") {
+                options.use_cache = true;
+                continue;
+            }
+
+            if (i + 1 >= args.size()) {
+                return usage();
+            }
+            const std::string& value = args[++i];
+
+            bool valid = true;
+            if (option == "--socket") {
+                options.socket_path = value;
+            }
+            else if (option == "--jobs") {
+                valid = parse_count(value, 4096, options.jobs);
+                has_jobs = true;
+            }
+            else if (option == "--prefork") {
+                valid = parse_count(value, 4096, options.prefork);
+                has_prefork = true;
+            }
+            else if (option == "--engine" && (value == "tree" || value == "vm")) {
+                options.engine = value == "tree" ? BREEZY_ENGINE_TREE_WALK : BREEZY_ENGINE_BYTECODE;
+            }
+            else {
+                valid = false;
+            }
+            if (!valid) {
+                return usage();
+            }
+        }
+
+        if (has_jobs && has_prefork) {
+            std::cerr << "--jobs and --prefork cannot be used together\n";
+            return usage();
+        }
+
+        if (options.socket_path.empty()) {
+            std::cerr << "serve needs --socket <path>\n";
+            return -3;
+        }
+
+        if (!open_wake_pipe()) {
+            std::cerr << "pipe() failed: " << std::strerror(errno) << "\n";
+            return -1;
+        }
+        install_signal_handlers();
+        int listener = open_listener(options.socket_path);
+        if (listener < 0) {
+            return -1;
+        }
+        std::cerr << "Serving on " << options.socket_path << "\n";
+
+        int result = options.prefork ? serve_prefork(listener, options) : serve_threads(listener, options);
+
+        ::close(listener);
+        ::unlink(options.socket_path.c_str());
+        return result;
+#endif
+    }
+}
@@ -37,6 +37,8 @@ namespace breezy::cli {
         aliases_["-h"] = "help";
         aliases_["--run"] = "run";
         aliases_["-r"] = "run";
+        aliases_["--serve"] = "serve";
+        aliases_["--profile"] = "profile";
     }
 
     const std::pair<std::string, std::vector<std::string>> 
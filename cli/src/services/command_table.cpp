@@ -34,6 +34,8 @@
 #include "commands/version_command.hpp"
 #include "commands/help_command.hpp"
 #include "commands/run_command.hpp"
+#include "commands/profile_command.hpp"
+#include "commands/serve_command.hpp"
 
 namespace breezy::cli {
     CommandTable::CommandTable() {
@@ -41,6 +43,8 @@ namespace breezy::cli {
         commands_["version"] = std::make_unique<VersionCommand>();
         commands_["help"] = std::make_unique<HelpCommand>();
         commands_["run"] = std::make_unique<RunCommand>();    
+        commands_["serve"] = std::make_unique<ServeCommand>();
+        commands_["profile"] = std::make_unique<ProfileCommand>();
     }
 
     const CommandBase* CommandTable::get_command(const std::string& name) const {
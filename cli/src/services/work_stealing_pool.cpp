@@ -0,0 +1,101 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "services/work_stealing_pool.hpp"
+
+#include <thread>
+
+namespace breezy::cli {
+    WorkStealingPool::WorkStealingPool(std::size_t threads) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        if (threads == 0) {
+            threads = 1;
+        }
+
+        workers_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_.push_back(std::make_unique<Worker>());
+        }
+    }
+
+    void WorkStealingPool::run(std::size_t count, const std::function<void(std::size_t)>& task) {
+        for (std::size_t i = 0; i < count; ++i) {
+            workers_[i % workers_.size()]->tasks.push_back(i);
+        }
+
+        // No more threads than tasks; the extra deques are empty and just get skipped
+        std::size_t threads = count < workers_.size() ? count : workers_.size();
+
+        std::vector<std::thread> helpers;
+        helpers.reserve(threads > 0 ? threads - 1 : 0);
+        for (std::size_t i = 1; i < threads; ++i) {
+            helpers.emplace_back(&WorkStealingPool::work, this, i, std::cref(task));
+        }
+        work(0, task);
+
+        for (auto& helper : helpers) {
+            helper.join();
+        }
+    }
+
+    void WorkStealingPool::work(std::size_t self, const std::function<void(std::size_t)>& task) {
+        // Nothing is queued after run() starts, so once every deque is empty the
+        // batch is done for this worker
+        std::size_t index;
+        while (take(self, index) || steal(self, index)) {
+            task(index);
+        }
+    }
+
+    bool WorkStealingPool::take(std::size_t self, std::size_t& index) {
+        Worker& worker = *workers_[self];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.tasks.empty()) {
+            return false;
+        }
+        index = worker.tasks.front();
+        worker.tasks.pop_front();
+        return true;
+    }
+
+    bool WorkStealingPool::steal(std::size_t self, std::size_t& index) {
+        for (std::size_t offset = 1; offset < workers_.size(); ++offset) {
+            Worker& victim = *workers_[(self + offset) % workers_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                index = victim.tasks.back();
+                victim.tasks.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+}
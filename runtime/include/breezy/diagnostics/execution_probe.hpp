@@ -0,0 +1,64 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_DIAGNOSTICS_EXECUTION_PROBE_HPP
+#define BREEZY_RUNTIME_DIAGNOSTICS_EXECUTION_PROBE_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace breezy::runtime {
+    /*
+    ============================
+    ExecutionProbe
+
+    Where a running engine currently is, published for the SamplingProfiler's
+    thread to read. The engine only ever does relaxed stores, so a probe costs it a
+    plain write per statement (tree walker) or per instruction (VM); engines that
+    were not given a probe skip even that.
+    ============================
+    */
+
+    struct ExecutionProbe {
+        static constexpr std::uint32_t none = 0xFFFFFFFFu;
+
+        // Source offset of the statement being executed (tree walker), or pc of the
+        // instruction being executed (VM)
+        std::atomic<std::uint32_t> position{ none };
+
+        // NativeRegistry index of the native being called
+        std::atomic<std::uint32_t> native{ none };
+
+        void enter(std::uint32_t at) { position.store(at, std::memory_order_relaxed); }
+        void enter_native(std::uint32_t index) { native.store(index, std::memory_order_relaxed); }
+        void leave_native() { native.store(none, std::memory_order_relaxed); }
+    };
+}
+
+#endif // !BREEZY_RUNTIME_DIAGNOSTICS_EXECUTION_PROBE_HPP
@@ -0,0 +1,110 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_DIAGNOSTICS_RUNTIME_STATS_HPP
+#define BREEZY_RUNTIME_DIAGNOSTICS_RUNTIME_STATS_HPP
+
+#include <chrono>
+#include <cstdint>
+
+/*
+============================
+Stat hooks
+
+Counters are bumped through BREEZY_STAT(...), which expands to its argument only
+when the runtime is built with BREEZY_STATS (the BREEZY_ENABLE_STATS option), and
+to nothing otherwise. RuntimeStats keeps the same layout either way; with stats
+compiled out its fields just stay zero.
+============================
+*/
+
+#ifdef BREEZY_STATS
+#  define BREEZY_STAT(statement) statement
+#else
+#  define BREEZY_STAT(statement) ((void)0)
+#endif
+
+namespace breezy::runtime {
+#ifdef BREEZY_STATS
+    inline constexpr bool stats_enabled = true;
+#else
+    inline constexpr bool stats_enabled = false;
+#endif
+
+    // Totals since the runtime was created or its stats were last cleared.
+    struct RuntimeStats {
+        // Frontend
+        std::uint64_t bytes_lexed = 0;
+        std::uint64_t tokens_lexed = 0;
+        std::uint64_t ast_nodes = 0;              // as parsed, before constant folding
+
+        // Execution. The tree walker counts statements and variable reads; the VM
+        // counts instructions (its variables are registers, not lookups).
+        std::uint64_t statements_executed = 0;
+        std::uint64_t instructions_executed = 0;
+        std::uint64_t variable_lookups = 0;
+        std::uint64_t native_calls = 0;
+        std::uint64_t allocations = 0;            // heap objects created while running
+        std::uint64_t allocated_bytes = 0;
+
+        // Wall time per phase, in seconds. Lexing streams into the parser, so it is
+        // part of parse_seconds; load_seconds is time spent in the program cache.
+        double parse_seconds = 0.0;
+        double resolve_seconds = 0.0;
+        double optimize_seconds = 0.0;
+        double compile_seconds = 0.0;
+        double load_seconds = 0.0;
+        double execute_seconds = 0.0;
+    };
+
+    // Adds the lifetime of the scope to `total`. A no-op without BREEZY_STATS.
+    class PhaseTimer {
+    public:
+#ifdef BREEZY_STATS
+        explicit PhaseTimer(double& total)
+            : total_(total), start_(std::chrono::steady_clock::now()) {}
+
+        ~PhaseTimer() {
+            total_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+        }
+
+    private:
+        double& total_;
+        std::chrono::steady_clock::time_point start_;
+#else
+        explicit PhaseTimer(double&) {}
+#endif
+
+    public:
+        PhaseTimer(const PhaseTimer&) = delete;
+        PhaseTimer& operator=(const PhaseTimer&) = delete;
+    };
+}
+
+#endif // !BREEZY_RUNTIME_DIAGNOSTICS_RUNTIME_STATS_HPP
@@ -0,0 +1,142 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_DIAGNOSTICS_SAMPLING_PROFILER_HPP
+#define BREEZY_RUNTIME_DIAGNOSTICS_SAMPLING_PROFILER_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "breezy/diagnostics/execution_probe.hpp"
+#include "breezy/vm/bytecode.hpp"
+#include "breezy/vm/natives.hpp"
+
+namespace breezy::runtime {
+    // What the runtime was doing when a sample was taken
+    enum class ProfilePhase : std::uint8_t {
+        Load,       // reading or writing the program cache
+        Parse,      // lexing and parsing
+        Resolve,
+        Optimize,
+        Compile,
+        Execute
+    };
+
+    const char* phase_name(ProfilePhase phase);
+
+    // Samples that agree on every other field, merged
+    struct ProfileEntry {
+        std::string script;
+        ProfilePhase phase;
+        std::uint32_t line;     // 1-based; 0 outside Execute or when the chunk has no positions
+        std::string native;     // native being called, empty if none
+        std::uint64_t samples;
+    };
+
+    /*
+    ============================
+    SamplingProfiler
+
+    A watchdog thread wakes `samples_per_second` times a second while a run is in
+    progress and records the run's phase and, during execution, the engine's
+    ExecutionProbe. The engine never waits on the sampler: it only publishes its
+    position, and a sample is a couple of relaxed loads plus a map update on the
+    sampler's side. Offsets are turned into lines only when the run ends, so the
+    sampler never touches the source.
+
+    The runtime brackets each run with begin_run() / end_run() and reports phase
+    changes in between; entries() accumulates over runs until clear().
+    ============================
+    */
+
+    class SamplingProfiler {
+    public:
+        static constexpr unsigned max_samples_per_second = 100000;
+
+        // `samples_per_second` is clamped to 1 .. max_samples_per_second.
+        explicit SamplingProfiler(unsigned samples_per_second);
+        ~SamplingProfiler();
+
+        SamplingProfiler(const SamplingProfiler&) = delete;
+        SamplingProfiler& operator=(const SamplingProfiler&) = delete;
+
+        // Handed to the engines through set_probe()
+        ExecutionProbe& probe() { return probe_; }
+
+        // Starts sampling a run of `script` in the Parse phase.
+        void begin_run(std::string_view script);
+        void set_phase(ProfilePhase phase);
+
+        // Enters Execute. The probe holds pcs into `chunk`, or source offsets when
+        // `chunk` is nullptr (tree walker); the chunk must outlive detach().
+        void attach(const Chunk* chunk);
+        void detach();
+
+        // Stops sampling and merges the run's samples into entries(), with offsets
+        // turned into lines of `source`.
+        void end_run(const NativeRegistry& natives, std::string_view source);
+
+        const std::vector<ProfileEntry>& entries() const { return entries_; }
+        unsigned samples_per_second() const { return samples_per_second_; }
+        void clear();
+
+    private:
+        // (phase, source offset, native index) -> samples
+        using SampleKey = std::tuple<ProfilePhase, std::uint32_t, std::uint32_t>;
+
+        const unsigned samples_per_second_;
+        ExecutionProbe probe_;
+
+        std::thread sampler_;
+        std::mutex mutex_;                  // guards everything below up to entries_
+        std::condition_variable wake_;
+        bool stopping_ = false;
+        ProfilePhase phase_ = ProfilePhase::Parse;
+        bool attached_ = false;
+        const Chunk* chunk_ = nullptr;
+        std::map<SampleKey, std::uint64_t> pending_;
+
+        std::string script_;
+        std::vector<ProfileEntry> entries_;
+        std::map<std::tuple<std::string, ProfilePhase, std::uint32_t, std::string>, std::size_t> entry_indices_;
+
+        void sample_loop();
+        void take_sample();
+        void stop();
+    };
+}
+
+#endif // !BREEZY_RUNTIME_DIAGNOSTICS_SAMPLING_PROFILER_HPP
@@ -0,0 +1,128 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_DIAGNOSTICS_TRACE_BUFFER_HPP
+#define BREEZY_RUNTIME_DIAGNOSTICS_TRACE_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace breezy::runtime {
+    // One finished span of a run, in steady-clock nanoseconds
+    struct TraceEvent {
+        std::string_view name;      // static text, or a native's name owned by the SymbolTable
+        const char* category;       // "runtime", "statement" or "native"
+        std::uint64_t start_ns;
+        std::uint64_t duration_ns;
+        std::uint64_t thread;       // hash of the id of the thread that ran the span
+        std::uint32_t offset;       // statements: source offset; none otherwise
+        std::uint32_t line;         // statements: 1-based line, filled in when the run ends
+    };
+
+    /*
+    ============================
+    TraceBuffer
+
+    A runtime's timeline: a ring of the most recent `capacity` spans. Only the thread
+    driving the runtime writes to it, so recording is a timestamp and a store with no
+    locks or atomics, and runtimes on other threads keep buffers of their own.
+    Timestamps come from std::chrono::steady_clock, which is shared by the whole
+    process, so buffers of different runtimes line up on one timeline.
+    ============================
+    */
+
+    class TraceBuffer {
+    public:
+        static constexpr std::uint32_t none = 0xFFFFFFFFu;
+
+        explicit TraceBuffer(std::size_t capacity);
+
+        static std::uint64_t now();
+
+        // Brackets a run: begin_run() notes the calling thread, end_run() turns the
+        // run's statement offsets into lines of `source`.
+        void begin_run();
+        void end_run(std::string_view source);
+
+        void record(std::string_view name, const char* category, std::uint64_t start_ns,
+                    std::uint32_t offset = none) {
+            TraceEvent event{ name, category, start_ns, now() - start_ns, thread_, offset, 0 };
+            if (events_.size() < capacity_) events_.push_back(event);
+            else events_[recorded_ % capacity_] = event;
+            ++recorded_;
+        }
+
+        // Oldest first
+        template <typename Fn>
+        void for_each(Fn&& fn) const {
+            std::size_t first = recorded_ > capacity_ ? recorded_ % capacity_ : 0;
+            for (std::size_t i = 0; i < events_.size(); ++i) {
+                fn(events_[(first + i) % events_.size()]);
+            }
+        }
+
+        std::size_t size() const { return events_.size(); }
+        std::size_t dropped() const { return recorded_ - events_.size(); }
+        void clear();
+
+    private:
+        std::size_t capacity_;
+        std::vector<TraceEvent> events_;    // grows up to capacity_, then wraps
+        std::size_t recorded_ = 0;          // events ever recorded
+        std::size_t run_start_ = 0;         // recorded_ when the current run began
+        std::uint64_t thread_ = 0;
+    };
+
+    // Records the lifetime of the scope as a span; a no-op when `buffer` is nullptr.
+    class TraceSpan {
+    public:
+        TraceSpan(TraceBuffer* buffer, std::string_view name, const char* category = "runtime",
+                  std::uint32_t offset = TraceBuffer::none)
+            : buffer_(buffer), name_(name), category_(category), offset_(offset),
+              start_(buffer ? TraceBuffer::now() : 0) {}
+
+        ~TraceSpan() {
+            if (buffer_) buffer_->record(name_, category_, start_, offset_);
+        }
+
+        TraceSpan(const TraceSpan&) = delete;
+        TraceSpan& operator=(const TraceSpan&) = delete;
+
+    private:
+        TraceBuffer* buffer_;
+        std::string_view name_;
+        const char* category_;
+        std::uint32_t offset_;
+        std::uint64_t start_;
+    };
+}
+
+#endif // !BREEZY_RUNTIME_DIAGNOSTICS_TRACE_BUFFER_HPP
@@ -30,34 +30,74 @@
 #ifndef BREEZY_RUNTIME_AST_HPP
 #define BREEZY_RUNTIME_AST_HPP
 
-#include <memory>
+#include <cstdint>
 #include <string_view>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
+#include "breezy/frontend/symbol_table.hpp"
+#include "breezy/memory/arena.hpp"
+
 namespace breezy::runtime {
 
     // Forward declarations
     struct LiteralExpr;
     struct VariableExpr;
     struct CallExpr;
+    struct UnaryExpr;
+    struct BinaryExpr;
 
     struct VarDeclStmt;
     struct ExprStmt;
+    struct BlockStmt;
 
     // Expression variant
     using Expr = std::variant<
         LiteralExpr,
         VariableExpr,
-        CallExpr
+        CallExpr,
+        UnaryExpr,
+        BinaryExpr
     >;
 
     // Statment variant
     using Stmt = std::variant<
         VarDeclStmt,
-        ExprStmt
+        ExprStmt,
+        BlockStmt
     >;
 
+    // Slot fields are filled in by the Resolver; the parser leaves them unresolved.
+    constexpr std::uint32_t unresolved_slot = 0xFFFFFFFFu;
+
+    /*
+    =======================
+    Operators
+    =======================
+    */
+
+    enum class UnaryOp : std::uint8_t {
+        Negate,
+        Not
+    };
+
+    enum class BinaryOp : std::uint8_t {
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Modulo,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Equal,
+        NotEqual,
+        And,
+        Or
+    };
+
     /*
     =======================
     Expression node definitions
@@ -65,16 +105,33 @@ namespace breezy::runtime {
     */
 
     struct LiteralExpr {
-        std::variant<double, std::string_view> value;
+        // std::monostate is nil; strings point into the source, without quotes
+        std::variant<double, std::int64_t, std::string_view, bool, std::monostate> value;
     };
 
     struct VariableExpr {
-        std::string_view name;
+        SymbolId name;
+        std::uint32_t offset;                  // source position, for diagnostics
+        std::uint32_t depth = 0;               // scopes between the use and the declaration
+        std::uint32_t slot = unresolved_slot;  // index within the declaring scope
     };
 
     struct CallExpr {
-        std::string_view callee;
-        std::vector<Expr> arguments;
+        SymbolId callee;
+        ArenaSpan<Expr> arguments;
+        std::uint32_t offset;                    // source position, for diagnostics
+        std::uint32_t native = unresolved_slot;  // index in the NativeRegistry
+    };
+
+    struct UnaryExpr {
+        UnaryOp op;
+        Expr* operand;
+    };
+
+    struct BinaryExpr {
+        BinaryOp op;
+        Expr* left;
+        Expr* right;
     };
 
     /*
@@ -84,12 +141,45 @@ namespace breezy::runtime {
     */
 
     struct VarDeclStmt {
-        std::string_view name;
-        std::unique_ptr<Expr> initializer;
+        SymbolId name;
+        Expr* initializer;      // nullptr when omitted
+        std::uint32_t offset;   // source position, for profiling and tracing
+        std::uint32_t slot = unresolved_slot;
     };
 
     struct ExprStmt {
         Expr expression;
+        std::uint32_t offset;   // source position, for profiling and tracing
+    };
+
+    struct BlockStmt {
+        ArenaSpan<Stmt> statements;
+        std::uint32_t offset;         // source position of '{', for profiling and tracing
+        std::uint32_t slot_count = 0; // variables declared directly in this block
+    };
+
+    inline std::uint32_t statement_offset(const Stmt& stmt) {
+        return std::visit([](auto&& node) { return node.offset; }, stmt);
+    }
+
+    // Nodes live in the compilation unit's arena and are never destroyed one by one.
+    static_assert(std::is_trivially_destructible_v<Expr>, "AST nodes must be arena-friendly");
+    static_assert(std::is_trivially_destructible_v<Stmt>, "AST nodes must be arena-friendly");
+
+    /*
+    =======================
+    Compilation unit
+    =======================
+    */
+
+    // A parsed source. Every node, argument list and child pointer of `statements` is
+    // allocated from `arena`, so the whole tree is released at once with the unit.
+    // The tree is deliberately not lowered to index-based node pools: with no loops or
+    // functions in the language every pass visits each node once, so the lowering
+    // would cost as much as the walk it speeds up.
+    struct CompilationUnit {
+        Arena arena;
+        std::vector<Stmt> statements;
     };
 }
 
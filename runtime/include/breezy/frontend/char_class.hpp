@@ -0,0 +1,79 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_FRONTEND_CHAR_CLASS_HPP
+#define BREEZY_RUNTIME_FRONTEND_CHAR_CLASS_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace breezy::runtime {
+    // Character classes used by the lexer. Matches the "C" locale behaviour of the
+    // <cctype> functions, so bytes >= 0x80 never belong to any class.
+    enum CharClass : std::uint8_t {
+        CharSpace      = 1 << 0,
+        CharIdentStart = 1 << 1,
+        CharIdentPart  = 1 << 2,
+        CharDigit      = 1 << 3,
+        CharSymbol     = 1 << 4,
+        CharQuote      = 1 << 5,
+        CharHexDigit   = 1 << 6
+    };
+
+    constexpr std::array<std::uint8_t, 256> make_char_class_table() {
+        std::array<std::uint8_t, 256> table{};
+
+        for (int c = 'a'; c <= 'z'; ++c) table[c] |= CharIdentStart | CharIdentPart;
+        for (int c = 'A'; c <= 'Z'; ++c) table[c] |= CharIdentStart | CharIdentPart;
+        for (int c = '0'; c <= '9'; ++c) table[c] |= CharIdentPart | CharDigit | CharHexDigit;
+        for (int c = 'a'; c <= 'f'; ++c) table[c] |= CharHexDigit;
+        for (int c = 'A'; c <= 'F'; ++c) table[c] |= CharHexDigit;
+        table['_'] |= CharIdentStart | CharIdentPart;
+
+        for (char c : { ' ', '\t', '\n', '\v', '\f', '\r' }) {
+            table[static_cast<unsigned char>(c)] |= CharSpace;
+        }
+
+        for (char c : { '+', '-', '*', '/', '%', '=', '<', '>', '!', '&', '|',
+                        ';', '(', ')', '{', '}', '[', ']', ',', '.' }) {
+            table[static_cast<unsigned char>(c)] |= CharSymbol;
+        }
+
+        table['"'] |= CharQuote;
+        return table;
+    }
+
+    inline constexpr std::array<std::uint8_t, 256> char_class_table = make_char_class_table();
+
+    constexpr bool has_char_class(char c, std::uint8_t mask) {
+        return (char_class_table[static_cast<unsigned char>(c)] & mask) != 0;
+    }
+}
+
+#endif // !BREEZY_RUNTIME_FRONTEND_CHAR_CLASS_HPP
@@ -30,26 +30,68 @@
 #ifndef BREEZY_RUNTIME_INTERPRETER_HPP
 #define BREEZY_RUNTIME_INTERPRETER_HPP
 
-#include <string_view>
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
+#include "breezy/diagnostics/execution_probe.hpp"
+#include "breezy/diagnostics/runtime_stats.hpp"
+#include "breezy/diagnostics/trace_buffer.hpp"
 #include "breezy/frontend/ast.hpp"
+#include "breezy/io/output_sink.hpp"
+#include "breezy/memory/heap.hpp"
+#include "breezy/vm/natives.hpp"
+#include "breezy/vm/value.hpp"
 
 namespace breezy::runtime {
     class Interpreter {
     public:
+        // Globals live at the front of `slots`, which may outlive the interpreter
+        // (and be shared with a VirtualMachine) to keep them across runs. Counters are
+        // added to `stats`.
+        Interpreter(Heap& heap, const NativeRegistry& natives, OutputSink& output, std::vector<Value>& slots,
+                    RuntimeStats& stats);
+
+        // Grows the global scope to `count` slots (see Resolver::global_count).
+        // Existing globals keep their values.
+        void ensure_globals(std::uint32_t count);
+
+        // Statements must have been through the Resolver.
         void execute(const Stmt& stmt);
 
+        // Publishes each statement's source offset and each native call to `probe`;
+        // nullptr (the default) publishes nothing.
+        void set_probe(ExecutionProbe* probe) { probe_ = probe; }
+
+        // Records a span for every native call in `trace`; nullptr records nothing.
+        void set_trace(TraceBuffer* trace) { trace_ = trace; }
+
     private:
-        std::unordered_map<std::string_view, double> environment_;
+        Heap& heap_;
+        const NativeRegistry& natives_;
+        OutputSink& output_;
+        RuntimeStats& stats_;
+        ExecutionProbe* probe_ = nullptr;
+        TraceBuffer* trace_ = nullptr;
+
+        // Slots of every active scope, globals first; scope_bases_ holds where each
+        // scope starts, innermost last.
+        std::vector<Value>& values_;
+        std::vector<std::size_t> scope_bases_;
+        std::vector<Value> arguments_; // evaluated call arguments, nested calls above outer ones
+
+        Value& slot(std::uint32_t depth, std::uint32_t slot);
 
         void exec_node(const VarDeclStmt& stmt);
         void exec_node(const ExprStmt& stmt);
+        void exec_node(const BlockStmt& stmt);
 
-        double eval(const Expr& expr);
-        double eval_node(const LiteralExpr& expr);
-        double eval_node(const VariableExpr& expr);
-        double eval_node(const CallExpr& expr);
+        Value eval(const Expr& expr);
+        Value eval_node(const LiteralExpr& expr);
+        Value eval_node(const VariableExpr& expr);
+        Value eval_node(const CallExpr& expr);
+        Value eval_node(const UnaryExpr& expr);
+        Value eval_node(const BinaryExpr& expr);
     };
 }
 
@@ -30,38 +30,50 @@
 #ifndef BREEZY_RUNTIME_FRONTEND_LEXER_HPP
 #define BREEZY_RUNTIME_FRONTEND_LEXER_HPP
 
+#include <array>
 #include <cstddef>
 #include <string_view>
-#include <vector>
 
+#include "breezy/frontend/symbol_table.hpp"
 #include "breezy/frontend/token.hpp"
 
 namespace breezy::runtime {
     class Lexer {
     public:
-        explicit Lexer(std::string_view source);
+        // Tokens that can be inspected ahead of the current one through peek_token().
+        static constexpr std::size_t lookahead_capacity = 4;
 
-        std::vector<Token> tokenize();
+        // Identifiers are interned into `symbols` as they are lexed.
+        Lexer(std::string_view source, SymbolTable& symbols);
 
-    private:
-        static constexpr std::string_view keywords_[] = {
-            "var",
-            "return",
-            "if",
-            "else"
-        };
+        // Batch interface: lexes the whole source up front (tooling, diagnostics).
+        TokenList tokenize();
+
+        // Pull interface: lexes on demand through a small lookahead ring. Once the
+        // source is exhausted both keep returning the EndOfFile token.
+        Token next_token();
+        const Token& peek_token(std::size_t ahead = 0);
+
+        std::string_view source() const { return source_; }
+
+        // Tokens scanned so far, EndOfFile included; only counted with BREEZY_STATS.
+        std::size_t token_count() const { return token_count_; }
 
+    private:
         std::string_view source_;
+        SymbolTable& symbols_;
         std::size_t position_ = 0;
-        std::uint32_t line_ = 1;
-        std::uint32_t column_ = 1;
 
-        char peek() const;
-        char advance();
+        std::array<Token, lookahead_capacity> ring_{};
+        std::size_t ring_head_ = 0;
+        std::size_t ring_count_ = 0;
+        std::size_t token_count_ = 0;
+
+        Token scan_token();
+        Token scan_number(std::uint32_t start);
+        const char* skip_digit_run(const char* it) const;
         bool is_at_end() const;
         void skip_white_space();
-
-        bool is_keyword(std::string_view lexeme);
     };
 }
 
@@ -0,0 +1,62 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_FRONTEND_NUMBER_LITERAL_HPP
+#define BREEZY_RUNTIME_FRONTEND_NUMBER_LITERAL_HPP
+
+#include <cstdint>
+#include <string_view>
+
+namespace breezy::runtime {
+    /*
+    ============================
+    Numeric literals
+
+    Accepted forms, with '_' allowed between any two digits:
+        123   1_000_000        integers
+        0x1F  0b1010           hex / binary integers
+        1.5   2e10  6.02e-23   floats
+
+    Parsing works directly on the source bytes and never allocates; floats are
+    converted with std::from_chars, which is correctly rounded.
+    ============================
+    */
+
+    struct NumberLiteral {
+        bool is_integer = false;
+        std::int64_t integer = 0; // valid when is_integer
+        double number = 0.0;      // always valid
+    };
+
+    // Returns false if `text` is malformed or an integer does not fit in 64 bits.
+    // Decimal integers too large for int64 are returned as floats.
+    bool parse_number_literal(std::string_view text, NumberLiteral& out);
+}
+
+#endif // !BREEZY_RUNTIME_FRONTEND_NUMBER_LITERAL_HPP
@@ -0,0 +1,67 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_FRONTEND_OPERATORS_HPP
+#define BREEZY_RUNTIME_FRONTEND_OPERATORS_HPP
+
+#include <string>
+
+#include "breezy/frontend/ast.hpp"
+#include "breezy/vm/value.hpp"
+
+namespace breezy::runtime {
+    class Heap;
+
+    // Operator semantics shared by the interpreter, the VM's slow paths and the
+    // parser's constant folder, so a folded expression always matches what
+    // evaluating it would produce.
+    //
+    // Integer arithmetic stays integral until it overflows int32, then continues in
+    // double; '/' always divides in double. Comparisons and logical operators yield
+    // booleans. Both return false when the operand types do not support `op`.
+    // `heap` is only needed to concatenate strings; with nullptr (as the constant
+    // folder passes) concatenation is reported as unsupported.
+    bool evaluate_unary(UnaryOp op, Value operand, Value& out);
+    bool evaluate_binary(BinaryOp op, Value left, Value right, Heap* heap, Value& out);
+
+    // The runtime value of a literal; string literals are interned in `heap`.
+    Value literal_value(const LiteralExpr& literal, Heap& heap);
+
+    // Conversions for the constant folders. A string literal needs `heap` to become
+    // a value and a string value needs `arena` to hold its text as a literal; with
+    // nullptr, strings are rejected. Both return false for what they cannot convert.
+    bool constant_value(const LiteralExpr& literal, Heap* heap, Value& out);
+    bool constant_literal(Value value, Arena* arena, LiteralExpr& out);
+
+    // Message for an operation evaluate_* rejected.
+    std::string operand_error(UnaryOp op, Value operand);
+    std::string operand_error(BinaryOp op, Value left, Value right);
+}
+
+#endif // !BREEZY_RUNTIME_FRONTEND_OPERATORS_HPP
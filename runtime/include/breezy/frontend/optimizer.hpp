@@ -0,0 +1,109 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_FRONTEND_OPTIMIZER_HPP
+#define BREEZY_RUNTIME_FRONTEND_OPTIMIZER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "breezy/frontend/ast.hpp"
+#include "breezy/io/output_sink.hpp"
+#include "breezy/memory/heap.hpp"
+#include "breezy/vm/natives.hpp"
+#include "breezy/vm/value.hpp"
+
+namespace breezy::runtime {
+    /*
+    ============================
+    Optimizer
+
+    Rewrites a resolved tree before it is executed or compiled:
+
+      - constant propagation: a read of a variable whose value is a known constant
+        becomes that constant. Scripts run straight through and a variable only
+        changes when it is declared again, so the value a read sees is the one of
+        the last declaration before it.
+      - folding of what propagation exposes: operators on constants, as the parser
+        does, plus string operands, '&&' / '||' decided by their left side, and
+        calls to pure natives with constant arguments. Anything that would raise an
+        error is left for the engine to report.
+      - dead-store elimination: declarations never read afterwards, and expression
+        statements, are dropped when evaluating them can neither print nor fail.
+        Globals that outlive the unit (a session's) are always stored.
+
+    A folded call is bound at optimization time, like the Resolver binds names: a
+    pure builtin replaced later by a host function does not change the result.
+    ============================
+    */
+
+    class Optimizer {
+    public:
+        // Pure natives are called with `output` but never write to it.
+        Optimizer(const NativeRegistry& natives, OutputSink& output);
+
+        // `global_count` is the size of the global scope (see Resolver::global_count).
+        // `globals_escape`: the unit's globals are read after it runs, so every store
+        // to them must be kept. Folded strings are allocated from the unit's arena.
+        void optimize(CompilationUnit& unit, std::uint32_t global_count, bool globals_escape);
+
+    private:
+        const NativeRegistry& natives_;
+        OutputSink& output_;
+        Heap heap_;                         // values of the constants being folded
+        Arena* arena_ = nullptr;
+        bool globals_escape_ = false;
+
+        // What is known of each variable in scope, laid out like the Interpreter's
+        // slots: globals first, then each enclosing block's; scope_bases_ holds where
+        // each scope starts, innermost last.
+        std::vector<std::optional<LiteralExpr>> constants_; // known values
+        std::vector<bool> live_;                            // read further on?
+        std::vector<std::size_t> scope_bases_;
+        std::vector<Value> arguments_;
+
+        std::size_t variable(std::uint32_t depth, std::uint32_t slot) const {
+            return scope_bases_[scope_bases_.size() - 1 - depth] + slot;
+        }
+
+        void propagate(Stmt& stmt);
+        void fold(Expr& expr);
+        void fold_call(Expr& expr, const CallExpr& call);
+
+        // Drops dead statements, walking backwards; returns how many are left, moved
+        // to the front.
+        std::size_t sweep(Stmt* statements, std::size_t count);
+        bool keep(Stmt& stmt);
+        void mark_reads(const Expr& expr);
+    };
+}
+
+#endif // !BREEZY_RUNTIME_FRONTEND_OPTIMIZER_HPP
@@ -30,22 +30,44 @@
 #ifndef BREEZY_RUNTIME_PARSER_HPP
 #define BREEZY_RUNTIME_PARSER_HPP
 
+#include <stdexcept>
 #include <string_view>
 #include <vector>
 
 #include "breezy/frontend/ast.hpp"
+#include "breezy/frontend/lexer.hpp"
 #include "breezy/frontend/token.hpp"
 
 namespace breezy::runtime {
     class Parser {
     public:
-        explicit Parser(const std::vector<Token>& tokens);
+        // Parses a pre-lexed token list.
+        Parser(const TokenList& tokens, Arena& arena);
 
+        // Pulls tokens from the lexer as it goes, so lexing and parsing run as one pass
+        // and only the lexer's lookahead ring is ever held in memory.
+        Parser(Lexer& lexer, Arena& arena);
+
+        // Nodes are allocated from the arena passed in; it must outlive the result.
         std::vector<Stmt> parse();
 
+        // Statement and expression nodes built so far, folded ones included; only
+        // counted with BREEZY_STATS.
+        std::size_t node_count() const { return node_count_; }
+
     private:
-        const std::vector<Token>& tokens_;
+        Arena& arena_;
+        const TokenList* tokens_ = nullptr;
+        Lexer* lexer_ = nullptr;
+        std::string_view source_;
         size_t current_ = 0;
+        Token previous_{};
+        std::size_t node_count_ = 0;
+
+        // Call arguments and block statements are collected here before being copied
+        // into the arena, so nested calls and blocks share one buffer each.
+        std::vector<Expr> scratch_;
+        std::vector<Stmt> stmt_scratch_;
 
         /*
         ============================
@@ -54,8 +76,9 @@ namespace breezy::runtime {
         */
 
         Stmt statement();
-        Stmt var_declaration();
-        Stmt expr_statement();
+        Stmt var_declaration(std::uint32_t offset);
+        Stmt block(std::uint32_t offset);
+        Stmt expr_statement(std::uint32_t offset);
 
         /*
         ============================
@@ -64,7 +87,16 @@ namespace breezy::runtime {
         */
 
         Expr expression();
+        Expr binary(int min_precedence);
+        Expr unary();
         Expr primary();
+        Expr call(const Token& callee);
+        Expr number_literal(const Token& token);
+        Expr string_literal(const Token& token);
+
+        // Build the node, or fold it to a literal when the operands are constants.
+        Expr make_unary(UnaryOp op, const Expr& operand);
+        Expr make_binary(BinaryOp op, const Expr& left, const Expr& right);
 
         /*
         ============================
@@ -72,13 +104,17 @@ namespace breezy::runtime {
         ============================
         */
 
-        bool match(TokenType type, const std::string_view lexeme = {});
-        bool check(TokenType type, const std::string_view lexeme = {}) const;
+        // `symbol` narrows the check to one keyword/identifier id or symbol character.
+        bool match(TokenType type, std::uint32_t symbol = no_symbol);
+        bool check(TokenType type, std::uint32_t symbol = no_symbol) const;
+        bool check_number() const;
         Token advance();
         bool is_at_end() const;
         Token peek() const;
         Token previous() const;
         Token consume(TokenType type, const std::string& message);
+        std::string_view lexeme(const Token& token) const;
+        std::runtime_error error(const Token& token, std::string_view message) const;
     };
 }
 
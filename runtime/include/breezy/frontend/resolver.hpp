@@ -0,0 +1,92 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_FRONTEND_RESOLVER_HPP
+#define BREEZY_RUNTIME_FRONTEND_RESOLVER_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "breezy/frontend/ast.hpp"
+#include "breezy/frontend/symbol_table.hpp"
+#include "breezy/vm/natives.hpp"
+
+namespace breezy::runtime {
+    /*
+    ============================
+    Resolver
+
+    Semantic pass between parsing and execution. Every declared variable gets a fixed
+    slot in its scope, and every reference is rewritten to the (depth, slot) pair of
+    the declaration it sees, and every call to its NativeRegistry index, so execution
+    never looks a name up. References to undeclared variables, calls to unknown
+    functions and wrong argument counts are reported here, before anything runs.
+
+    Top-level declarations land in the global scope, which persists across resolve()
+    calls; redeclaring a name in the same scope reuses its slot. A resolve() that
+    fails leaves the global scope as it was.
+    ============================
+    */
+
+    class Resolver {
+    public:
+        Resolver(const SymbolTable& symbols, const NativeRegistry& natives);
+
+        // Throws std::runtime_error on the first error.
+        void resolve(CompilationUnit& unit, std::string_view source);
+
+        // Forgets every global.
+        void reset();
+
+        std::uint32_t global_count() const { return scopes_.front().count; }
+
+    private:
+        struct Scope {
+            std::unordered_map<SymbolId, std::uint32_t> slots;
+            std::uint32_t count = 0;
+        };
+
+        const SymbolTable& symbols_;
+        const NativeRegistry& natives_;
+        std::vector<Scope> scopes_;
+        std::vector<SymbolId> new_globals_; // declared by the resolve() in progress
+        std::string_view source_;
+
+        void resolve_stmt(Stmt& stmt);
+        void resolve_expr(Expr& expr);
+
+        std::uint32_t declare(SymbolId name);
+        std::runtime_error error(std::uint32_t offset, std::string_view message) const;
+    };
+}
+
+#endif // !BREEZY_RUNTIME_FRONTEND_RESOLVER_HPP
@@ -0,0 +1,53 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_FRONTEND_SCANNER_HPP
+#define BREEZY_RUNTIME_FRONTEND_SCANNER_HPP
+
+namespace breezy::runtime::scanner {
+    /*
+    ============================
+    Span scanners
+
+    Each function returns a pointer to the first byte in [begin, end) that does not
+    belong to the scanned class, or end. The vector paths (AVX2 when compiled with it,
+    SSE2 on any x86-64 target) handle full blocks; the scalar tail walks the same
+    character-class table, so both paths agree byte for byte.
+    ============================
+    */
+
+    const char* skip_whitespace(const char* begin, const char* end);
+    const char* skip_identifier(const char* begin, const char* end);
+    const char* skip_digits(const char* begin, const char* end);
+
+    // Returns a pointer to the next '"' or end.
+    const char* find_quote(const char* begin, const char* end);
+}
+
+#endif // !BREEZY_RUNTIME_FRONTEND_SCANNER_HPP
@@ -0,0 +1,165 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_FRONTEND_SYMBOL_TABLE_HPP
+#define BREEZY_RUNTIME_FRONTEND_SYMBOL_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace breezy::runtime {
+    // Dense id handed out by the SymbolTable; compare and hash these instead of names.
+    using SymbolId = std::uint32_t;
+
+    constexpr SymbolId no_symbol = 0xFFFFFFFFu;
+
+    /*
+    ============================
+    Well-known symbols
+
+    Keywords are interned first, in this order, so a keyword's id is its index in
+    `keywords`. Builtin function names are registered by the NativeRegistry.
+    ============================
+    */
+
+    namespace symbols {
+        constexpr SymbolId Var    = 0;
+        constexpr SymbolId Return = 1;
+        constexpr SymbolId If     = 2;
+        constexpr SymbolId Else   = 3;
+        constexpr SymbolId True   = 4;
+        constexpr SymbolId False  = 5;
+        constexpr SymbolId Nil    = 6;
+
+        constexpr std::string_view keywords[] = {
+            "var",
+            "return",
+            "if",
+            "else",
+            "true",
+            "false",
+            "nil"
+        };
+    }
+
+    /*
+    ============================
+    Keyword perfect hash
+
+    Keywords are few and fixed, so a hash of (first char, last char, length) into a
+    16-entry table is collision free for them; the static_assert below catches a new
+    keyword that breaks that.
+    ============================
+    */
+
+    namespace detail {
+        constexpr std::size_t keyword_table_size = 16;
+
+        constexpr std::size_t keyword_hash(std::string_view text) {
+            return (static_cast<unsigned char>(text.front())
+                  + static_cast<unsigned char>(text.back()) * 3u
+                  + text.size()) & (keyword_table_size - 1);
+        }
+
+        struct KeywordTable {
+            std::uint8_t slots[keyword_table_size];
+            bool perfect;
+        };
+
+        constexpr KeywordTable make_keyword_table() {
+            KeywordTable table{};
+            table.perfect = true;
+            for (auto& slot : table.slots) slot = 0xFF;
+
+            std::uint8_t index = 0;
+            for (std::string_view keyword : symbols::keywords) {
+                std::size_t hash = keyword_hash(keyword);
+                if (table.slots[hash] != 0xFF) table.perfect = false;
+                table.slots[hash] = index++;
+            }
+            return table;
+        }
+
+        inline constexpr KeywordTable keyword_table = make_keyword_table();
+        static_assert(keyword_table.perfect, "Keyword hash collides; adjust keyword_hash()");
+    }
+
+    // Returns the keyword's symbol id, or no_symbol if `text` is not a keyword.
+    constexpr SymbolId keyword_symbol(std::string_view text) {
+        if (text.empty()) return no_symbol;
+        std::uint8_t index = detail::keyword_table.slots[detail::keyword_hash(text)];
+        if (index == 0xFF || symbols::keywords[index] != text) return no_symbol;
+        return index;
+    }
+
+    /*
+    ============================
+    SymbolTable
+
+    Per-runtime string interner. Names are copied into storage owned by the table, so
+    symbols outlive the source they were lexed from, and each name's hash is computed
+    once when it is interned.
+    ============================
+    */
+
+    class SymbolTable {
+    public:
+        SymbolTable();
+
+        SymbolId intern(std::string_view name);
+
+        std::string_view name(SymbolId id) const { return names_[id]; }
+        std::uint32_t hash(SymbolId id) const { return hashes_[id]; }
+        std::size_t size() const { return names_.size(); }
+
+        static std::uint32_t hash_name(std::string_view name);
+
+    private:
+        struct Slot {
+            std::uint32_t hash;
+            SymbolId id;
+        };
+
+        std::vector<Slot> slots_;
+        std::vector<std::string_view> names_;
+        std::vector<std::uint32_t> hashes_;
+
+        std::vector<std::unique_ptr<char[]>> blocks_;
+        std::size_t block_used_ = 0;
+        std::size_t block_size_ = 0;
+
+        std::string_view store(std::string_view name);
+        void grow();
+    };
+}
+
+#endif // !BREEZY_RUNTIME_FRONTEND_SYMBOL_TABLE_HPP
@@ -30,24 +30,115 @@
 #ifndef BREEZY_RUNTIME_FRONTEND_TOKEN_HPP
 #define BREEZY_RUNTIME_FRONTEND_TOKEN_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
+#include <vector>
 
 namespace breezy::runtime {
-    enum class TokenType {
+    enum class TokenType : std::uint8_t {
         Identifier,
-        Number,
+        Integer,
+        Float,
         String,
         Keyword,
         Symbol,
         EndOfFile
     };
 
+    // Symbol tokens carry their character in Token::symbol. Two-character operators
+    // get these ids instead, which sit above the byte range.
+    namespace punct {
+        constexpr std::uint32_t EqualEqual   = 256;
+        constexpr std::uint32_t BangEqual    = 257;
+        constexpr std::uint32_t LessEqual    = 258;
+        constexpr std::uint32_t GreaterEqual = 259;
+        constexpr std::uint32_t AndAnd       = 260;
+        constexpr std::uint32_t OrOr         = 261;
+
+        constexpr std::uint32_t count = 262;
+    }
+
+    // Tokens refer back into the source they were lexed from by byte offset and length.
+    // Line and column are resolved on demand through a LineTable. `symbol` is the
+    // interned SymbolId for identifiers and keywords and the character for symbols.
+    // The length and type share one word, so a token takes 12 bytes; the Lexer
+    // rejects tokens longer than max_length.
     struct Token {
-        TokenType type;
-        std::string_view lexeme;
-        std::uint32_t line;
-        std::uint32_t column;
+        static constexpr std::uint32_t type_bits = 8;
+        static constexpr std::uint32_t max_length = (1u << (32 - type_bits)) - 1;
+
+        std::uint32_t offset = 0;
+        std::uint32_t symbol = 0;
+        std::uint32_t packed = 0; // length << type_bits | type
+
+        Token() = default;
+
+        Token(TokenType type, std::uint32_t offset, std::uint32_t length, std::uint32_t symbol)
+            : offset(offset), symbol(symbol), packed((length << type_bits) | static_cast<std::uint32_t>(type)) {}
+
+        TokenType type() const { return static_cast<TokenType>(packed & ((1u << type_bits) - 1)); }
+        std::uint32_t length() const { return packed >> type_bits; }
+    };
+
+    static_assert(sizeof(Token) == 12, "Token should stay packed");
+
+    /*
+    ============================
+    TokenList
+
+    Struct-of-arrays token storage: the parser walks the type column far more often
+    than it touches offsets or symbols, so each field lives in its own dense array.
+    The type column is the packed length-and-type word of Token, 12 bytes a token
+    in all.
+    ============================
+    */
+
+    class TokenList {
+    public:
+        explicit TokenList(std::string_view source)
+            : source_(source) {}
+
+        void reserve(std::size_t count) {
+            packed_.reserve(count);
+            offsets_.reserve(count);
+            symbols_.reserve(count);
+        }
+
+        void push_back(const Token& token) {
+            packed_.push_back(token.packed);
+            offsets_.push_back(token.offset);
+            symbols_.push_back(token.symbol);
+        }
+
+        std::size_t size() const { return packed_.size(); }
+        std::string_view source() const { return source_; }
+
+        Token operator[](std::size_t index) const {
+            Token token;
+            token.offset = offsets_[index];
+            token.symbol = symbols_[index];
+            token.packed = packed_[index];
+            return token;
+        }
+
+        TokenType type(std::size_t index) const {
+            return static_cast<TokenType>(packed_[index] & ((1u << Token::type_bits) - 1));
+        }
+
+        std::string_view lexeme(std::size_t index) const {
+            return source_.substr(offsets_[index], packed_[index] >> Token::type_bits);
+        }
+
+        std::string_view lexeme(const Token& token) const {
+            return source_.substr(token.offset, token.length());
+        }
+
+    private:
+        std::string_view source_;
+        std::vector<std::uint32_t> packed_;
+        std::vector<std::uint32_t> offsets_;
+        std::vector<std::uint32_t> symbols_;
     };
 }
 
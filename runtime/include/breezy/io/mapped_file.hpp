@@ -0,0 +1,81 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_IO_MAPPED_FILE_HPP
+#define BREEZY_RUNTIME_IO_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace breezy::runtime {
+    /*
+    ============================
+    MappedFile
+
+    Read-only memory map of a whole file. Pages come straight from the OS page cache
+    on first touch, so opening a file costs no read() into a private buffer. The file
+    must not be truncated while it is mapped; writers should replace it by renaming
+    a new file over it instead.
+    ============================
+    */
+
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Returns false if the file cannot be opened or mapped. An empty file opens
+        // as an empty view.
+        bool open(const std::filesystem::path& path);
+        void close();
+
+        // Hints that the file will be read front to back, so the OS reads ahead
+        // aggressively. No-op where unsupported.
+        void advise_sequential() const;
+
+        bool is_open() const { return open_; }
+        const char* data() const { return data_; }
+        std::size_t size() const { return size_; }
+        std::string_view view() const { return { data_, size_ }; }
+
+    private:
+        const char* data_ = nullptr; // nullptr for an empty file
+        std::size_t size_ = 0;
+        bool open_ = false;
+    };
+}
+
+#endif // !BREEZY_RUNTIME_IO_MAPPED_FILE_HPP
@@ -0,0 +1,102 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_IO_OUTPUT_SINK_HPP
+#define BREEZY_RUNTIME_IO_OUTPUT_SINK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "breezy/vm/value.hpp"
+
+namespace breezy::runtime {
+    /*
+    ============================
+    OutputSink
+
+    Everything a runtime writes goes through its sink: script output is collected in
+    a 64 KiB buffer and handed on when the buffer fills or flush() is called (the
+    runtime flushes after every run); diagnostics flush pending output first, then
+    go out immediately, so the two streams stay in order.
+
+    Numbers are formatted with std::to_chars: the shortest text that reads back as
+    the same double, without iostream or locale overhead.
+
+    By default output goes to stdout / stderr. A writer callback redirects both, for
+    embedders that want to capture them.
+    ============================
+    */
+
+    enum class OutputStream : int {
+        Out = 1,
+        Err = 2
+    };
+
+    using OutputWriter = void (*)(OutputStream stream, const char* data, std::size_t size, void* user_data);
+
+    class OutputSink {
+    public:
+        static constexpr std::size_t capacity = 64 * 1024;
+
+        OutputSink();
+        ~OutputSink();
+
+        OutputSink(const OutputSink&) = delete;
+        OutputSink& operator=(const OutputSink&) = delete;
+
+        // nullptr restores stdout / stderr. Pending output is flushed to the old writer.
+        void set_writer(OutputWriter writer, void* user_data);
+
+        void write(std::string_view text);
+        void write(char c);
+        void write_number(double value);
+        void write_integer(std::int64_t value);
+        // The way print() shows a value
+        void write_value(Value value);
+
+        // Writes a diagnostic line to the error stream
+        void error(std::string_view text);
+
+        void flush();
+
+    private:
+        std::unique_ptr<char[]> buffer_;
+        std::size_t used_ = 0;
+        OutputWriter writer_ = nullptr;
+        void* user_data_ = nullptr;
+
+        void emit(OutputStream stream, const char* data, std::size_t size);
+        // Guarantees room for `size` more bytes, flushing if needed
+        char* reserve(std::size_t size);
+    };
+}
+
+#endif // !BREEZY_RUNTIME_IO_OUTPUT_SINK_HPP
@@ -0,0 +1,119 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_MEMORY_ARENA_HPP
+#define BREEZY_RUNTIME_MEMORY_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace breezy::runtime {
+    // A run of arena-allocated elements. Owns nothing; the arena does.
+    template <typename T>
+    struct ArenaSpan {
+        T* data = nullptr;
+        std::uint32_t size = 0;
+
+        T* begin() const { return data; }
+        T* end() const { return data + size; }
+        bool empty() const { return size == 0; }
+        T& operator[](std::size_t index) const { return data[index]; }
+    };
+
+    /*
+    ============================
+    Arena
+
+    Bump allocator over a chain of blocks. Allocation is a pointer increment, and
+    everything is released at once when the arena is reset or destroyed, so objects
+    placed in it must be trivially destructible.
+    ============================
+    */
+
+    class Arena {
+    public:
+        static constexpr std::size_t default_block_size = 64 * 1024;
+
+        explicit Arena(std::size_t block_size = default_block_size);
+        ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        void* allocate(std::size_t size, std::size_t alignment);
+
+        template <typename T, typename... Args>
+        T* make(Args&&... args) {
+            static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+            return new (allocate(sizeof(T), alignof(T))) T{ std::forward<Args>(args)... };
+        }
+
+        template <typename T>
+        ArenaSpan<T> make_span(const T* values, std::size_t count) {
+            static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+            if (count == 0) return {};
+
+            T* data = static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+            for (std::size_t i = 0; i < count; ++i) new (data + i) T(values[i]);
+            return { data, static_cast<std::uint32_t>(count) };
+        }
+
+        // Releases every allocation. The first block is kept for reuse.
+        void reset();
+
+        // Bytes handed out since the last reset, and the most ever handed out at once.
+        std::size_t size() const { return used_; }
+        std::size_t peak_bytes() const { return peak_; }
+
+        // Bytes reserved from the system, including unused block tails.
+        std::size_t capacity() const { return capacity_; }
+
+    private:
+        struct Block {
+            Block* next;
+            std::size_t size;
+        };
+
+        Block* head_ = nullptr;
+        char* cursor_ = nullptr;
+        char* limit_ = nullptr;
+
+        std::size_t block_size_;
+        std::size_t used_ = 0;
+        std::size_t peak_ = 0;
+        std::size_t capacity_ = 0;
+
+        void add_block(std::size_t min_size);
+    };
+}
+
+#endif // !BREEZY_RUNTIME_MEMORY_ARENA_HPP
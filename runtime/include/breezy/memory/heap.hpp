@@ -0,0 +1,82 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_MEMORY_HEAP_HPP
+#define BREEZY_RUNTIME_MEMORY_HEAP_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <unordered_map>
+
+#include "breezy/vm/value.hpp"
+
+namespace breezy::runtime {
+    /*
+    ============================
+    Heap
+
+    Owns every runtime object. Objects are immutable and kept until the heap is
+    destroyed; there is no collector yet. String literals are interned, so the same
+    literal compiled twice yields the same object, while strings built at run time
+    (concatenation) are always fresh.
+    ============================
+    */
+
+    class Heap {
+    public:
+        Heap() = default;
+        ~Heap();
+
+        Heap(const Heap&) = delete;
+        Heap& operator=(const Heap&) = delete;
+
+        // Frees every object; Values pointing into the heap become dangling.
+        void reset();
+
+        const StringObject* intern(std::string_view text);
+        const StringObject* concat(const StringObject* left, const StringObject* right);
+
+        std::size_t object_count() const { return object_count_; }
+        std::size_t bytes() const { return bytes_; }
+
+    private:
+        Object* objects_ = nullptr; // most recent first
+        std::size_t object_count_ = 0;
+        std::size_t bytes_ = 0;
+
+        std::unordered_map<std::string_view, const StringObject*> interned_;
+
+        // Allocates a string of `length` characters; the caller fills them in and
+        // then calls finish().
+        StringObject* allocate_string(std::size_t length);
+        const StringObject* finish(StringObject* string);
+    };
+}
+
+#endif // !BREEZY_RUNTIME_MEMORY_HEAP_HPP
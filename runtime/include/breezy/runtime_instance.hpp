@@ -30,19 +30,158 @@
 #ifndef BREEZY_RUNTIME_INSTANCE_HPP
 #define BREEZY_RUNTIME_INSTANCE_HPP
 
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
+
+#include "breezy/diagnostics/runtime_stats.hpp"
+#include "breezy/diagnostics/sampling_profiler.hpp"
+#include "breezy/diagnostics/trace_buffer.hpp"
+#include "breezy/frontend/ast.hpp"
+#include "breezy/frontend/optimizer.hpp"
+#include "breezy/frontend/resolver.hpp"
+#include "breezy/frontend/symbol_table.hpp"
+#include "breezy/io/output_sink.hpp"
+#include "breezy/memory/heap.hpp"
+#include "breezy/vm/bytecode.hpp"
+#include "breezy/vm/natives.hpp"
+#include "breezy/vm/program.hpp"
+#include "breezy/vm/program_cache.hpp"
+#include "breezy/vm/value.hpp"
 
 namespace breezy::runtime {
+    // How resolved programs are executed. Both engines must produce identical output,
+    // which makes the tree walker a reference to cross-check the VM against.
+    enum class Engine {
+        TreeWalk,   // Interpreter: walks the AST directly
+        Bytecode    // Compiler + VirtualMachine
+    };
+
+    /*
+    ============================
+    RuntimeInstance
+
+    A long-lived session. Interned symbols, natives, heap objects and globals carry
+    over from one run to the next, so a snippet can use variables an earlier one
+    declared and each run only pays for its own new code. reset() returns to a fresh
+    session while keeping registered natives and the output writer.
+
+    Programs are the compile-once path: compile() produces a standalone Program and
+    execute() runs it on the VM with its own globals and scratch heap, leaving the
+    session alone. With the program cache enabled, run_file() takes that path too
+    on the bytecode engine, loading the compiled script from the cache when its
+    source is unchanged.
+
+    Between resolving and executing, the Optimizer rewrites the tree unless the
+    optimization level is 0.
+    ============================
+    */
+
     class RuntimeInstance {
     public:
         RuntimeInstance();
         ~RuntimeInstance();
 
-        void run_file(const std::string& filepath);
-        void run_string(const std::string& code);
+        // Both return false if the script failed to load, compile or run; the error
+        // has been reported to the output by then. On either engine a runtime error
+        // ends only the top-level statement that raised it.
+        bool run_file(const std::string& filepath);
+        bool run_string(const std::string& code);
+
+        // Drops every global and heap object.
+        void reset();
+
+        // Compiles `code` against the natives registered so far. A program sees none
+        // of the session's globals. Reports the error and returns nullptr if `code`
+        // does not compile.
+        std::unique_ptr<Program> compile(std::string_view code);
+
+        // Links `program` by native name and runs it; strings it builds are freed
+        // when it returns. Reports the error and returns false if a native is
+        // missing or the script fails.
+        bool execute(const Program& program);
+
+        // Exposes a host function to scripts run after this call. Replaces any
+        // native with the same name.
+        void register_native(const std::string& name, HostFunction function, int arity, void* user_data);
+
+        // Redirects script output and diagnostics; nullptr restores stdout / stderr.
+        void set_output(OutputWriter writer, void* user_data);
+
+        // Caches files run with run_file() in `directory`, or in
+        // ProgramCache::default_directory() when it is empty. Files then run as
+        // standalone programs: they neither see nor leave session globals. The cache
+        // holds optimized programs, so it is bypassed at optimization level 0.
+        void enable_cache(const std::filesystem::path& directory);
+        void disable_cache() { cache_.reset(); }
+
+        void set_engine(Engine engine) { engine_ = engine; }
+        Engine engine() const { return engine_; }
+
+        // 0 runs trees as parsed; 1, the default, runs them through the Optimizer.
+        void set_optimization_level(unsigned level) { optimization_level_ = level; }
+        unsigned optimization_level() const { return optimization_level_; }
+
+        // Counters and phase timings accumulated over every run since the runtime
+        // was created or clear_stats() was called. All zero unless the runtime was
+        // built with BREEZY_STATS; reset() leaves them alone.
+        const RuntimeStats& stats() const { return stats_; }
+        void clear_stats() { stats_ = RuntimeStats{}; }
+
+        // Samples every later run_file() / run_string() at `samples_per_second` (see
+        // SamplingProfiler). Enabling again starts over with an empty profile.
+        void enable_profiling(unsigned samples_per_second);
+        void disable_profiling() { profiler_.reset(); }
+        const SamplingProfiler* profiler() const { return profiler_.get(); }
+
+        // Records a timeline of later runs, keeping the most recent `capacity` spans:
+        // file load, parse, resolve, optimize, compile, execute, every top-level
+        // statement and every native call. Enabling again starts over with an empty
+        // buffer.
+        void enable_tracing(std::size_t capacity) { trace_ = std::make_unique<TraceBuffer>(capacity); }
+        void disable_tracing() { trace_.reset(); }
+        const TraceBuffer* trace() const { return trace_.get(); }
 
     private:
-        void execute(const std::string& code);
+        OutputSink output_;
+        SymbolTable symbols_;
+        Heap heap_;
+        NativeRegistry natives_;
+        Optimizer optimizer_;
+        Engine engine_ = Engine::Bytecode;
+        unsigned optimization_level_ = 1;
+        std::optional<ProgramCache> cache_;
+        RuntimeStats stats_;
+        std::unique_ptr<SamplingProfiler> profiler_;
+        std::unique_ptr<TraceBuffer> trace_;
+
+        // Session state
+        Resolver resolver_;
+        std::vector<Value> slots_;  // globals first; shared by both engines
+        CompilationUnit unit_;      // reused so its arena keeps its first block
+        std::vector<std::uint32_t> session_links_;
+
+        // Program execution
+        Heap program_heap_;                     // strings built by the running program
+        std::vector<Value> program_registers_;  // all nil at the start of each run
+        std::uint64_t linked_program_ = 0;      // id of the program program_links_ belongs to;
+                                                // 0 once the natives change
+        std::vector<std::uint32_t> program_links_;
+
+        bool execute(std::string_view code);
+        bool execute_cached(std::string_view code);
+        bool parse(std::string_view code, CompilationUnit& unit);
+        bool resolve(Resolver& resolver, CompilationUnit& unit, std::string_view code);
+        void optimize(CompilationUnit& unit, std::uint32_t global_count, bool globals_escape);
+        void enter_phase(ProfilePhase phase) { if (profiler_) profiler_->set_phase(phase); }
+
+        // Maps each of the chunk's imports to this runtime's registry by name.
+        // Throws std::runtime_error if one is missing or has another arity.
+        void link(const Chunk& chunk, std::vector<std::uint32_t>& links);
     };
 }
 
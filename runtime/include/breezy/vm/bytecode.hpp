@@ -0,0 +1,143 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_VM_BYTECODE_HPP
+#define BREEZY_RUNTIME_VM_BYTECODE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "breezy/vm/value.hpp"
+
+namespace breezy::runtime {
+    /*
+    ============================
+    Bytecode
+
+    Register-based: every operand names a slot in the VM's register file rather than
+    a stack position, so `a = b + c` is one instruction with no pushes or pops.
+    Registers [0, global_count) are the program's globals, block locals sit above
+    them at compile-time known offsets, and expression temporaries sit above those.
+
+    Notation below: R[x] is a register, K[x] a constant pool entry, bx the 32-bit
+    operand made of b (low half) and c (high half).
+    ============================
+    */
+
+    enum class OpCode : std::uint8_t {
+        LoadK,          // R[a] = K[bx]
+        LoadNil,        // R[a] = nil
+        Move,           // R[a] = R[b]
+
+        Negate,         // R[a] = -R[b]
+        Not,            // R[a] = !truthy(R[b])
+        Bool,           // R[a] = truthy(R[b])
+
+        Add,            // R[a] = R[b] + R[c]
+        Subtract,       // R[a] = R[b] - R[c]
+        Multiply,       // R[a] = R[b] * R[c]
+        Divide,         // R[a] = R[b] / R[c]
+        Modulo,         // R[a] = fmod(R[b], R[c])
+        Less,           // R[a] = R[b] <  R[c]
+        LessEqual,      // R[a] = R[b] <= R[c]
+        Greater,        // R[a] = R[b] >  R[c]
+        GreaterEqual,   // R[a] = R[b] >= R[c]
+        Equal,          // R[a] = R[b] == R[c]
+        NotEqual,       // R[a] = R[b] != R[c]
+
+        Jump,           // pc = bx
+        JumpIfFalse,    // if !truthy(R[a]): pc = bx
+        JumpIfTrue,     // if truthy(R[a]): pc = bx
+
+        CallNative,     // R[a] = imports[b](R[a] .. R[a + c - 1])
+        Halt,
+
+        Count
+    };
+
+    struct Instruction {
+        OpCode op;
+        std::uint8_t reserved = 0;
+        std::uint16_t a = 0;
+        std::uint16_t b = 0;
+        std::uint16_t c = 0;
+
+        std::uint32_t bx() const { return b | (static_cast<std::uint32_t>(c) << 16); }
+    };
+
+    static_assert(sizeof(Instruction) == 8, "Instructions are packed into 8 bytes");
+
+    constexpr std::uint32_t max_registers = 0x10000;
+
+    // A native the chunk calls. Calls go through the chunk's own import table, so
+    // the chunk can be linked against any registry that defines the same names.
+    struct NativeImport {
+        std::string name;
+        int arity;            // as resolved at compile time
+        std::uint32_t native; // index in the registry the chunk was compiled against
+    };
+
+    // Maps code back to source: the statement at source `offset` starts at `pc`.
+    struct SourcePosition {
+        std::uint32_t pc;
+        std::uint32_t offset;
+    };
+
+    // A compiled unit: straight-line code ending in Halt.
+    struct Chunk {
+        std::vector<Instruction> code;
+        std::vector<Value> constants; // strings point into the Heap the chunk was compiled with
+        std::vector<NativeImport> imports;
+        std::vector<SourcePosition> positions;  // every non-block statement, ascending pc
+        std::vector<SourcePosition> statements; // top-level statements, ascending pc
+        std::uint32_t register_count = 0; // globals + deepest locals + temporaries
+    };
+
+    // Source offset of the statement the instruction at `pc` belongs to, or
+    // no_source_offset if the chunk has no positions for it.
+    constexpr std::uint32_t no_source_offset = 0xFFFFFFFFu;
+
+    inline std::uint32_t source_offset(const Chunk& chunk, std::uint32_t pc) {
+        auto it = std::upper_bound(chunk.positions.begin(), chunk.positions.end(), pc,
+            [](std::uint32_t target, const SourcePosition& position) { return target < position.pc; });
+        return it == chunk.positions.begin() ? no_source_offset : (it - 1)->offset;
+    }
+
+    // First pc of the top-level statement after the one `pc` belongs to, or the final
+    // Halt if that was the last.
+    inline std::uint32_t next_statement_pc(const Chunk& chunk, std::uint32_t pc) {
+        auto it = std::upper_bound(chunk.statements.begin(), chunk.statements.end(), pc,
+            [](std::uint32_t target, const SourcePosition& position) { return target < position.pc; });
+        return it == chunk.statements.end() ? static_cast<std::uint32_t>(chunk.code.size() - 1) : it->pc;
+    }
+}
+
+#endif // !BREEZY_RUNTIME_VM_BYTECODE_HPP
@@ -0,0 +1,106 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_VM_COMPILER_HPP
+#define BREEZY_RUNTIME_VM_COMPILER_HPP
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "breezy/frontend/ast.hpp"
+#include "breezy/memory/heap.hpp"
+#include "breezy/vm/bytecode.hpp"
+#include "breezy/vm/natives.hpp"
+
+namespace breezy::runtime {
+    // Bump whenever the Compiler or the Optimizer changes the code it emits for a
+    // source, so program files compiled by an older runtime are not reused.
+    constexpr std::uint32_t compiler_version = 2;
+
+    /*
+    ============================
+    Compiler
+
+    Lowers a resolved CompilationUnit to a Chunk. Because blocks nest lexically and
+    their slot counts are known, every variable maps to a fixed register; only
+    expression temporaries are allocated, stack-like, as code is emitted.
+    ============================
+    */
+
+    class Compiler {
+    public:
+        // String constants are interned in `heap`, which must outlive the chunk.
+        // `natives` must be the registry the unit was resolved against.
+        Compiler(Heap& heap, const NativeRegistry& natives);
+
+        // `unit` must have been through the Resolver; `global_count` is the
+        // Resolver's global scope size. Throws std::runtime_error if the program
+        // needs more registers than an instruction can address.
+        Chunk compile(const CompilationUnit& unit, std::uint32_t global_count);
+
+    private:
+        using Reg = std::uint16_t;
+
+        Heap& heap_;
+        const NativeRegistry& natives_;
+        Chunk chunk_;
+        std::vector<std::uint32_t> scope_bases_; // first register of each open scope
+        std::uint32_t locals_top_ = 0;           // end of the variable registers
+        std::uint32_t top_ = 0;                  // first free temporary
+        std::unordered_map<std::uint64_t, std::uint32_t> constant_indices_;
+        std::unordered_map<std::uint32_t, std::uint32_t> import_indices_; // registry index -> import
+
+        void statement(const Stmt& stmt);
+        void block(const BlockStmt& stmt);
+
+        // Evaluates `expr` into `dest`.
+        void expression(const Expr& expr, Reg dest);
+        // Returns a register holding `expr`: the variable's own register when it is
+        // one, otherwise a fresh temporary.
+        Reg operand(const Expr& expr);
+        void logical(const BinaryExpr& expr, Reg dest);
+        // Returns the register the call's result is left in.
+        Reg call(const CallExpr& expr);
+
+        Reg variable(const VariableExpr& expr) const;
+        Reg allocate();
+        void reserve_registers(std::uint32_t end);
+        std::uint32_t constant(Value value);
+        std::uint32_t import(std::uint32_t native);
+
+        std::size_t emit(OpCode op, std::uint32_t a = 0, std::uint32_t b = 0, std::uint32_t c = 0);
+        std::size_t emit_bx(OpCode op, std::uint32_t a, std::uint32_t bx);
+        void patch_jump(std::size_t at);
+        // Records that the code emitted next belongs to the statement at `offset`.
+        void mark_position(std::uint32_t offset);
+    };
+}
+
+#endif // !BREEZY_RUNTIME_VM_COMPILER_HPP
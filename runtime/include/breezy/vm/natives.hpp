@@ -0,0 +1,114 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_VM_NATIVES_HPP
+#define BREEZY_RUNTIME_VM_NATIVES_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "breezy/frontend/symbol_table.hpp"
+#include "breezy/io/output_sink.hpp"
+#include "breezy/memory/heap.hpp"
+#include "breezy/vm/value.hpp"
+
+namespace breezy::runtime {
+    /*
+    ============================
+    Native functions
+
+    Every callable is a native: the builtins registered at startup plus whatever the
+    host adds through the C API. The Resolver binds each call to its index in the
+    registry, so a call is an array load and an indirect call, and calls to unknown
+    functions or with the wrong number of arguments are rejected before running.
+    ============================
+    */
+
+    struct Native;
+
+    // What a native sees of the runtime during a call.
+    struct NativeCall {
+        Heap& heap;
+        OutputSink& out;
+        const Native& native;
+    };
+
+    // Throws std::runtime_error to raise a runtime error.
+    using NativeFunction = Value (*)(NativeCall& call, const Value* args, std::uint32_t count);
+
+    // Host functions registered through the C API take and return numbers.
+    using HostFunction = double (*)(const double* args, int count, void* user_data);
+
+    constexpr int variadic = -1;
+
+    struct Native {
+        std::string_view name;   // owned by the SymbolTable
+        NativeFunction function;
+        int arity;               // argument count, or variadic
+        HostFunction host = nullptr;
+        void* user_data = nullptr;
+        bool pure = false;       // no side effects and the result depends only on the
+                                 // arguments, so calls on constants may be folded
+    };
+
+    class NativeRegistry {
+    public:
+        static constexpr std::uint32_t npos = 0xFFFFFFFFu;
+
+        // Registers the builtins (print, abs, sqrt, floor, ceil, min, max, len); all
+        // but print are pure.
+        explicit NativeRegistry(SymbolTable& symbols);
+
+        // Defining an existing name replaces its function but keeps its index. Host
+        // functions are never pure.
+        std::uint32_t define(std::string_view name, NativeFunction function, int arity, bool pure = false);
+        std::uint32_t define_host(std::string_view name, HostFunction function, int arity, void* user_data);
+
+        // Returns npos if `name` is not a native.
+        std::uint32_t find(SymbolId name) const;
+
+        const Native& operator[](std::uint32_t index) const { return natives_[index]; }
+        std::size_t size() const { return natives_.size(); }
+
+        // Hash of every native's name, arity, purity and whether the host defined it:
+        // what compiled code may depend on, since calls to pure natives are folded.
+        std::uint64_t fingerprint() const;
+
+    private:
+        SymbolTable& symbols_;
+        std::vector<Native> natives_;
+        std::unordered_map<SymbolId, std::uint32_t> indices_;
+
+        std::uint32_t define(const Native& native);
+    };
+}
+
+#endif // !BREEZY_RUNTIME_VM_NATIVES_HPP
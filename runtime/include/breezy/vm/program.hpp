@@ -0,0 +1,66 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_VM_PROGRAM_HPP
+#define BREEZY_RUNTIME_VM_PROGRAM_HPP
+
+#include <cstdint>
+
+#include "breezy/memory/heap.hpp"
+#include "breezy/vm/bytecode.hpp"
+
+namespace breezy::runtime {
+    /*
+    ============================
+    Program
+
+    A script compiled once to be executed many times. It owns everything its chunk
+    refers to: string constants live in the program's own heap and natives are
+    imported by name, so a program does not depend on the runtime that compiled it.
+    Nothing in it is written after compilation, which makes one program safe to
+    execute from several threads at once, each on its own runtime.
+    ============================
+    */
+
+    struct Program {
+        Program();
+
+        Program(const Program&) = delete;
+        Program& operator=(const Program&) = delete;
+
+        Heap heap;   // string constants only
+        Chunk chunk;
+
+        // Unique per program for the life of the process, unlike its address, so
+        // runtimes can cache how they linked it.
+        const std::uint64_t id;
+    };
+}
+
+#endif // !BREEZY_RUNTIME_VM_PROGRAM_HPP
@@ -0,0 +1,121 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_VM_PROGRAM_CACHE_HPP
+#define BREEZY_RUNTIME_VM_PROGRAM_CACHE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "breezy/vm/program.hpp"
+
+namespace breezy::runtime {
+    /*
+    ============================
+    Program files
+
+    A Program saved to disk so that an unchanged script skips the frontend. The file
+    records the format and compiler versions, the fingerprint of the natives it was
+    compiled against and a copy of its source, and is rejected unless all of them
+    match: the Optimizer folds calls to pure natives, so a host that redefines one
+    must not be handed code folded with the builtin.
+    Values and instructions are stored in host byte order, so files are only meant
+    to be read on the machine that wrote them.
+
+        header      magic "BZBC", format version, compiler version, natives
+                    fingerprint, source hash, source length, register / code / constant / import / position /
+                    statement counts
+        source      the source text
+        code        the Instructions, 8 bytes each
+        constants   a kind byte, then the Value's bits or a length-prefixed string
+        imports     arity, then the length-prefixed native name
+        positions   the statement position table, 8 bytes per entry
+        statements  the top-level statement table, 8 bytes per entry
+
+    Loaded code is verified before it is used: every register, constant, jump and
+    import operand must be in range, and both position tables must be sorted and point
+    into the code and the source, so a corrupt file is rejected rather than run.
+    ============================
+    */
+
+    // Bump whenever the bytecode or the file layout changes; code generation changes
+    // bump compiler_version instead.
+    constexpr std::uint32_t program_format_version = 4;
+
+    // 64-bit FNV-1a. Names cache entries and rejects most mismatches early; it is
+    // not collision resistant, which is why files keep the whole source to compare.
+    std::uint64_t hash_source(std::string_view source);
+
+    // `natives` is the NativeRegistry::fingerprint() of the registry `program` was
+    // compiled against.
+    std::string serialize_program(const Program& program, std::string_view source, std::uint64_t natives);
+
+    // Returns nullptr if `data` is not a valid program file for `source` and `natives`.
+    std::unique_ptr<Program> deserialize_program(std::string_view data, std::string_view source, std::uint64_t natives);
+
+    /*
+    ============================
+    ProgramCache
+
+    A directory of program files named after their source hash, natives fingerprint
+    and the format and compiler versions, so an edited script misses and a copied or
+    moved one still hits. Entries are
+    written to a temporary file and renamed into place, which keeps concurrent
+    processes from ever mapping a half-written entry.
+    ============================
+    */
+
+    class ProgramCache {
+    public:
+        explicit ProgramCache(std::filesystem::path directory);
+
+        // $XDG_CACHE_HOME/breezy, else ~/.cache/breezy (%LOCALAPPDATA%\breezy\cache
+        // on Windows); empty if none of those variables is set.
+        static std::filesystem::path default_directory();
+
+        // `natives` as for serialize_program. Returns nullptr on a miss or an unusable
+        // entry.
+        std::unique_ptr<Program> load(std::string_view source, std::uint64_t natives) const;
+
+        // Best effort: failures to write are ignored, the next run just misses again.
+        void store(const Program& program, std::string_view source, std::uint64_t natives) const;
+
+        const std::filesystem::path& directory() const { return directory_; }
+
+    private:
+        std::filesystem::path directory_;
+
+        std::filesystem::path entry(std::uint64_t source_hash, std::uint64_t natives) const;
+    };
+}
+
+#endif // !BREEZY_RUNTIME_VM_PROGRAM_CACHE_HPP
@@ -0,0 +1,153 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_VM_VALUE_HPP
+#define BREEZY_RUNTIME_VM_VALUE_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace breezy::runtime {
+    /*
+    ============================
+    Heap objects
+
+    Every heap value starts with an Object header. Objects are owned by a Heap and
+    linked through `next` so the heap can release them together.
+    ============================
+    */
+
+    enum class ObjectType : std::uint8_t {
+        String
+    };
+
+    struct Object {
+        ObjectType type;
+        Object* next;
+    };
+
+    // Immutable; the characters follow the header in the same allocation and are
+    // NUL-terminated.
+    struct StringObject : Object {
+        std::uint32_t length;
+        std::uint32_t hash;
+
+        const char* chars() const { return reinterpret_cast<const char*>(this + 1); }
+        std::string_view view() const { return { chars(), length }; }
+    };
+
+    /*
+    ============================
+    Value
+
+    Every runtime value in 8 bytes, NaN-boxed. A double is stored as itself; all
+    other types live in the payload of one quiet-NaN pattern that no arithmetic
+    result produces (quiet bit plus bit 50, sign clear):
+
+        0x7FFC'0000'0000'000x   nil (1), false (2), true (3)
+        0x7FFD'0000'xxxx'xxxx   int32
+        0x7FFE'xxxx'xxxx'xxxx   Object* (48-bit address)
+
+    A double whose bits happen to fall in that range is replaced by the canonical NaN
+    on construction, so is_double() is a single mask test.
+    ============================
+    */
+
+    class Value {
+    public:
+        Value() : bits_(nil_bits) {}
+
+        static Value number(double value) {
+            std::uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            if ((bits & box_mask) == box_mask) bits = canonical_nan;
+            return from_bits(bits);
+        }
+        static Value integer(std::int32_t value) { return from_bits(int_tag | static_cast<std::uint32_t>(value)); }
+        static Value boolean(bool value) { return from_bits(value ? true_bits : false_bits); }
+        static Value nil() { return from_bits(nil_bits); }
+        static Value object(const Object* object) { return from_bits(object_tag | reinterpret_cast<std::uintptr_t>(object)); }
+
+        // Integers outside the int32 range become doubles
+        static Value from_int64(std::int64_t value) {
+            if (value >= INT32_MIN && value <= INT32_MAX) return integer(static_cast<std::int32_t>(value));
+            return number(static_cast<double>(value));
+        }
+
+        static Value from_bits(std::uint64_t bits) { Value v; v.bits_ = bits; return v; }
+        std::uint64_t bits() const { return bits_; }
+
+        bool is_double() const { return (bits_ & box_mask) != box_mask; }
+        bool is_int() const { return (bits_ >> 48) == (int_tag >> 48); }
+        bool is_number() const { return is_double() || is_int(); }
+        bool is_bool() const { return (bits_ | 1) == true_bits; }
+        bool is_nil() const { return bits_ == nil_bits; }
+        bool is_object() const { return (bits_ >> 48) == (object_tag >> 48); }
+        bool is_string() const { return is_object() && as_object()->type == ObjectType::String; }
+
+        double as_double() const { double d; std::memcpy(&d, &bits_, sizeof(d)); return d; }
+        std::int32_t as_int() const { return static_cast<std::int32_t>(static_cast<std::uint32_t>(bits_)); }
+        bool as_bool() const { return bits_ == true_bits; }
+        const Object* as_object() const { return reinterpret_cast<const Object*>(static_cast<std::uintptr_t>(bits_ & payload_mask)); }
+        const StringObject* as_string() const { return static_cast<const StringObject*>(as_object()); }
+
+        // Either numeric representation, as a double
+        double to_double() const { return is_int() ? as_int() : as_double(); }
+
+        // nil, false and numeric zero are falsy; everything else is truthy
+        bool truthy() const {
+            if (is_double()) return as_double() != 0;
+            if (is_int()) return as_int() != 0;
+            return bits_ == true_bits || is_object();
+        }
+
+        static constexpr std::uint64_t box_mask      = 0x7FFC000000000000ull;
+        static constexpr std::uint64_t canonical_nan = 0x7FF8000000000000ull;
+        static constexpr std::uint64_t nil_bits      = box_mask | 1;
+        static constexpr std::uint64_t false_bits    = box_mask | 2;
+        static constexpr std::uint64_t true_bits     = box_mask | 3;
+        static constexpr std::uint64_t int_tag       = 0x7FFD000000000000ull;
+        static constexpr std::uint64_t object_tag    = 0x7FFE000000000000ull;
+        static constexpr std::uint64_t payload_mask  = 0x0000FFFFFFFFFFFFull;
+
+    private:
+        std::uint64_t bits_;
+    };
+
+    static_assert(sizeof(Value) == 8, "Values are NaN-boxed into 8 bytes");
+
+    // Language equality: numbers compare numerically across int and double, strings
+    // by content, everything else by identity.
+    bool values_equal(Value a, Value b);
+
+    const char* type_name(Value value);
+}
+
+#endif // !BREEZY_RUNTIME_VM_VALUE_HPP
@@ -0,0 +1,107 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#ifndef BREEZY_RUNTIME_VM_VM_HPP
+#define BREEZY_RUNTIME_VM_VM_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "breezy/diagnostics/execution_probe.hpp"
+#include "breezy/diagnostics/runtime_stats.hpp"
+#include "breezy/diagnostics/trace_buffer.hpp"
+#include "breezy/frontend/ast.hpp"
+#include "breezy/io/output_sink.hpp"
+#include "breezy/memory/heap.hpp"
+#include "breezy/vm/bytecode.hpp"
+#include "breezy/vm/natives.hpp"
+#include "breezy/vm/value.hpp"
+
+namespace breezy::runtime {
+    /*
+    ============================
+    VirtualMachine
+
+    Executes Chunks over a single register file of NaN-boxed Values. Arithmetic and
+    comparisons test the operand tags inline and only call into the shared operator
+    semantics for mixed or non-numeric operands. Dispatch uses computed goto on
+    GCC/Clang, giving each handler its own indirect branch, and falls back to a
+    switch elsewhere (or when BREEZY_VM_SWITCH_DISPATCH is defined).
+
+    Globals written by one chunk are visible to the next one compiled against the
+    same Resolver, as long as both run over the same register file.
+    ============================
+    */
+
+    class VirtualMachine {
+    public:
+        // `heap` receives strings built at run time.
+        // Globals are the first registers of `registers`, which may outlive the VM (and
+        // be shared with an Interpreter) to keep them across runs. Counters are added
+        // to `stats`.
+        VirtualMachine(Heap& heap, const NativeRegistry& natives, OutputSink& output, std::vector<Value>& registers,
+                       RuntimeStats& stats);
+
+        // `links[i]` is the index in `natives` of `chunk.imports[i]`; string constants
+        // must outlive the run. Starts at `pc`, which is 0 or the first instruction of
+        // a top-level statement. Throws std::runtime_error on a type error, after which
+        // failed_pc() is the instruction that raised it.
+        void run(const Chunk& chunk, const std::vector<std::uint32_t>& links, std::uint32_t pc = 0);
+
+        std::uint32_t failed_pc() const { return failed_pc_; }
+
+        // Publishes the pc of every instruction and each native call to `probe`;
+        // nullptr (the default) runs the unprobed dispatch loop.
+        void set_probe(ExecutionProbe* probe) { probe_ = probe; }
+
+        // Records a span for every top-level statement (from chunk.statements) and
+        // every native call in `trace`; nullptr runs the untraced dispatch loop.
+        void set_trace(TraceBuffer* trace) { trace_ = trace; }
+
+    private:
+        Heap& heap_;
+        const NativeRegistry& natives_;
+        OutputSink& output_;
+        std::vector<Value>& registers_;
+        RuntimeStats& stats_;
+        ExecutionProbe* probe_ = nullptr;
+        TraceBuffer* trace_ = nullptr;
+        std::uint32_t failed_pc_ = 0;
+
+        // The dispatch loop, compiled with and without the probe stores and trace spans
+        template <bool Probed, bool Traced>
+        void dispatch(const Chunk& chunk, const std::vector<std::uint32_t>& links, std::uint32_t pc);
+
+        // Every operand combination the inline fast paths do not cover
+        Value unary_slow(UnaryOp op, Value operand);
+        Value binary_slow(BinaryOp op, Value left, Value right);
+    };
+}
+
+#endif // !BREEZY_RUNTIME_VM_VM_HPP
@@ -37,17 +37,178 @@
 #    define BREEZY_RUNTIME_API __declspec(dllimport)
 #  endif
 #else
-    #error "Zephyr, breezy's runtime environment, currently only supports Windows"
+#  define BREEZY_RUNTIME_API __attribute__((visibility("default")))
 #endif
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-BREEZY_RUNTIME_API void breezy_runtime_init();
-BREEZY_RUNTIME_API void breezy_runtime_shutdown();
-BREEZY_RUNTIME_API void breezy_runtime_run_string(const char* code);
-BREEZY_RUNTIME_API void breezy_runtime_run_file(const char* filepath);
+/*
+    Each runtime is an independent isolate with its own symbols, heap, natives, globals
+    and output: nothing is shared between runtimes, so separate threads may each drive
+    their own runtime without locking. A single runtime must not be used by two
+    threads at once.
+*/
+typedef struct breezy_runtime breezy_runtime;
+
+typedef enum breezy_engine {
+    BREEZY_ENGINE_TREE_WALK = 0,  /* reference AST interpreter */
+    BREEZY_ENGINE_BYTECODE  = 1   /* bytecode VM (default) */
+} breezy_engine;
+
+/*
+    Host functions callable from scripts. Arguments arrive as doubles (a non-number
+    argument is a runtime error in the script) and the return value becomes the call's
+    result. `arity` is the exact argument count, or BREEZY_VARIADIC.
+*/
+typedef double (*breezy_native_fn)(const double* args, int argc, void* user_data);
+
+#define BREEZY_VARIADIC (-1)
+
+/*
+    Receives everything the runtime writes: script output in large chunks (at least
+    once per run) and diagnostics one line at a time, tagged with the stream they
+    would otherwise go to.
+*/
+typedef enum breezy_stream {
+    BREEZY_STREAM_STDOUT = 1,
+    BREEZY_STREAM_STDERR = 2
+} breezy_stream;
+
+typedef void (*breezy_output_fn)(breezy_stream stream, const char* data, size_t size, void* user_data);
+
+/* Returns NULL if the runtime could not be allocated. */
+BREEZY_RUNTIME_API breezy_runtime* breezy_runtime_create(void);
+BREEZY_RUNTIME_API void breezy_runtime_destroy(breezy_runtime* runtime);
+
+/* Both return 0 on success, -1 if the script failed to load, compile or run (after reporting why) or an argument is invalid. */
+BREEZY_RUNTIME_API int breezy_runtime_run_string(breezy_runtime* runtime, const char* code);
+BREEZY_RUNTIME_API int breezy_runtime_run_file(breezy_runtime* runtime, const char* filepath);
+
+/* Globals and strings persist across run calls; reset returns to an empty session. */
+BREEZY_RUNTIME_API void breezy_runtime_reset(breezy_runtime* runtime);
+BREEZY_RUNTIME_API void breezy_runtime_set_engine(breezy_runtime* runtime, breezy_engine engine);
+
+/*
+    0 runs scripts as parsed. 1, the default, first propagates constants, folds calls
+    to pure builtins and drops statements with no effect. Level 0 bypasses the
+    compiled-script cache, which holds optimized programs.
+*/
+BREEZY_RUNTIME_API void breezy_runtime_set_optimization(breezy_runtime* runtime, int level);
+
+/*
+    Compiled-script cache for run_file. When enabled, a file run on the bytecode
+    engine is compiled once and later runs of the same source load the bytecode from
+    `directory` (NULL for the user cache directory: $XDG_CACHE_HOME/breezy,
+    ~/.cache/breezy or %LOCALAPPDATA%\breezy\cache). Cached files run as standalone
+    programs, like breezy_execute: they neither see nor leave session globals.
+    Disabled by default.
+*/
+BREEZY_RUNTIME_API void breezy_runtime_set_cache(breezy_runtime* runtime, int enabled, const char* directory);
+
+/* Pass NULL to restore stdout / stderr. */
+BREEZY_RUNTIME_API void breezy_runtime_set_output(breezy_runtime* runtime, breezy_output_fn fn, void* user_data);
+
+/* Returns 0 on success, -1 if an argument is invalid. */
+BREEZY_RUNTIME_API int breezy_runtime_register_native(breezy_runtime* runtime, const char* name, breezy_native_fn fn, int arity, void* user_data);
+
+/*
+    Compile once, execute many times. A program is compiled against the natives
+    registered on `runtime` so far, sees none of the session's globals and always
+    runs on the bytecode VM; each execution starts from fresh globals and pays no
+    parsing or compilation cost. Programs are immutable and do not reference the
+    runtime that compiled them: one program may be executed by any runtime that
+    defines the natives it calls, from several threads at once, and may outlive the
+    runtime that compiled it.
+*/
+typedef struct breezy_program breezy_program;
+
+/* Returns NULL, after reporting the error on `runtime`, if `source` does not compile. */
+BREEZY_RUNTIME_API breezy_program* breezy_compile(breezy_runtime* runtime, const char* source);
+
+/* Returns 0 on success, -1 on a link or runtime error or if an argument is invalid. */
+BREEZY_RUNTIME_API int breezy_execute(breezy_runtime* runtime, const breezy_program* program);
+
+BREEZY_RUNTIME_API void breezy_program_free(breezy_program* program);
+
+/*
+    Counters and per-phase wall times, summed over every run since the runtime was
+    created or its stats were reset (breezy_runtime_reset leaves them alone). Lexing
+    streams into the parser, so its time is part of parse_seconds; load_seconds is
+    time spent in the compiled-script cache. Statements and variable lookups are
+    counted by the tree-walk engine, instructions by the bytecode VM.
+*/
+typedef struct breezy_stats {
+    uint64_t bytes_lexed;
+    uint64_t tokens_lexed;
+    uint64_t ast_nodes;
+    uint64_t statements_executed;
+    uint64_t instructions_executed;
+    uint64_t variable_lookups;
+    uint64_t native_calls;
+    uint64_t allocations;
+    uint64_t allocated_bytes;
+    double parse_seconds;
+    double resolve_seconds;
+    double optimize_seconds;
+    double compile_seconds;
+    double load_seconds;
+    double execute_seconds;
+} breezy_stats;
+
+/* Returns 0 on success, -1 if an argument is invalid or the runtime was built without stats. */
+BREEZY_RUNTIME_API int breezy_runtime_get_stats(const breezy_runtime* runtime, breezy_stats* stats);
+BREEZY_RUNTIME_API void breezy_runtime_reset_stats(breezy_runtime* runtime);
+
+/*
+    Sampling profiler. While enabled, a background thread samples every run_file and
+    run_string call `samples_per_second` times a second, recording the phase the run
+    is in and, while executing, the line of the statement being executed and the
+    native being called. Samples that agree on all of these are merged into one
+    entry; entries accumulate over runs.
+*/
+typedef struct breezy_profile_entry {
+    const char* script;   /* file path, or "<string>" */
+    const char* phase;    /* "load", "parse", "resolve", "optimize", "compile" or "execute" */
+    uint32_t line;        /* 1-based; 0 outside "execute" or when unknown */
+    const char* native;   /* native being called, or NULL */
+    uint64_t samples;
+} breezy_profile_entry;
+
+/* 0 disables the profiler and discards its samples; enabling again starts afresh. At most 100000 samples a second. */
+BREEZY_RUNTIME_API void breezy_runtime_set_profiling(breezy_runtime* runtime, unsigned samples_per_second);
+
+/* Returns the entry count and points `entries` at them; valid until the next call on `runtime`. */
+BREEZY_RUNTIME_API size_t breezy_runtime_get_profile(breezy_runtime* runtime, const breezy_profile_entry** entries);
+
+/*
+    Timeline tracing. While enabled, the runtime records a span for each phase of a
+    run (load, cache load, parse, resolve, optimize, compile, cache store, execute),
+    each top-level statement and each native call, keeping the most recent `capacity`
+    spans. Recording takes no locks: every runtime has its own buffer. Timestamps are
+    steady-clock nanoseconds shared by the whole process, so spans of runtimes on
+    different threads line up; `thread` tells those threads apart. Lexing streams
+    into parsing and is part of "parse".
+*/
+typedef struct breezy_trace_event {
+    const char* name;       /* not NUL-terminated: name_size bytes, valid while the runtime lives */
+    size_t name_size;
+    const char* category;   /* "runtime", "statement" or "native" */
+    uint64_t start_ns;
+    uint64_t duration_ns;
+    uint64_t thread;
+    uint32_t line;          /* statements: 1-based source line, or 0 if unknown; otherwise 0 */
+} breezy_trace_event;
+
+/* 0 disables tracing and discards the spans; enabling again starts afresh. */
+BREEZY_RUNTIME_API void breezy_runtime_set_tracing(breezy_runtime* runtime, size_t capacity);
+
+/* Returns the span count and points `events` at them, oldest first; valid until the next call on `runtime`. */
+BREEZY_RUNTIME_API size_t breezy_runtime_get_trace(breezy_runtime* runtime, const breezy_trace_event** events);
 
 #ifdef __cplusplus
 }
@@ -29,31 +29,231 @@
 
 #include "breezy_runtime_interface.h"
 
+#include <memory>
+#include <new>
+#include <vector>
+
 #include "breezy/runtime_instance.hpp"
+#include "breezy/vm/program.hpp"
+
+// The embedder's output callback, adapted to the runtime's writer signature
+struct OutputBinding {
+    breezy_output_fn fn;
+    void* user_data;
+};
+
+// Everything an isolate needs lives in its handle; this file keeps no global state.
+struct breezy_runtime {
+    breezy::runtime::RuntimeInstance instance;
+    OutputBinding output = { nullptr, nullptr };
+    std::vector<breezy_profile_entry> profile; // last breezy_runtime_get_profile result
+    std::vector<breezy_trace_event> trace;     // last breezy_runtime_get_trace result
+};
+
+struct breezy_program {
+    std::unique_ptr<const breezy::runtime::Program> program;
+};
 
-static breezy::runtime::RuntimeInstance* g_runtime = nullptr;
+static void forward_output(breezy::runtime::OutputStream stream, const char* data, size_t size, void* binding) {
+    auto* output = static_cast<OutputBinding*>(binding);
+    output->fn(static_cast<breezy_stream>(stream), data, size, output->user_data);
+}
 
 extern "C" {
-    void breezy_runtime_init() {
-        if (!g_runtime) {
-            g_runtime = new breezy::runtime::RuntimeInstance();
+    breezy_runtime* breezy_runtime_create(void) {
+        try {
+            return new breezy_runtime();
+        }
+        catch (const std::bad_alloc&) {
+            return nullptr;
+        }
+    }
+
+    void breezy_runtime_destroy(breezy_runtime* runtime) {
+        delete runtime;
+    }
+
+    int breezy_runtime_run_string(breezy_runtime* runtime, const char* code) {
+        if (!runtime || !code) {
+            return -1;
+        }
+        return runtime->instance.run_string(code) ? 0 : -1;
+    }
+
+    int breezy_runtime_run_file(breezy_runtime* runtime, const char* filepath) {
+        if (!runtime || !filepath) {
+            return -1;
+        }
+        return runtime->instance.run_file(filepath) ? 0 : -1;
+    }
+
+    void breezy_runtime_reset(breezy_runtime* runtime) {
+        if (runtime) {
+            runtime->instance.reset();
+        }
+    }
+
+    void breezy_runtime_set_engine(breezy_runtime* runtime, breezy_engine engine) {
+        if (runtime) {
+            runtime->instance.set_engine(engine == BREEZY_ENGINE_TREE_WALK
+                ? breezy::runtime::Engine::TreeWalk
+                : breezy::runtime::Engine::Bytecode);
+        }
+    }
+
+    void breezy_runtime_set_optimization(breezy_runtime* runtime, int level) {
+        if (runtime && level >= 0) {
+            runtime->instance.set_optimization_level(static_cast<unsigned>(level));
+        }
+    }
+
+    void breezy_runtime_set_cache(breezy_runtime* runtime, int enabled, const char* directory) {
+        if (!runtime) {
+            return;
+        }
+        if (enabled) {
+            runtime->instance.enable_cache(directory ? directory : "");
+        }
+        else {
+            runtime->instance.disable_cache();
+        }
+    }
+
+    int breezy_runtime_register_native(breezy_runtime* runtime, const char* name, breezy_native_fn fn, int arity, void* user_data) {
+        if (!runtime || !name || !*name || !fn || arity < BREEZY_VARIADIC) {
+            return -1;
         }
+        runtime->instance.register_native(name, fn, arity, user_data);
+        return 0;
     }
 
-    void breezy_runtime_shutdown() {
-        delete g_runtime;
-        g_runtime = nullptr;
+    void breezy_runtime_set_output(breezy_runtime* runtime, breezy_output_fn fn, void* user_data) {
+        if (runtime) {
+            runtime->output = { fn, user_data };
+            runtime->instance.set_output(fn ? forward_output : nullptr, &runtime->output);
+        }
+    }
+
+    breezy_program* breezy_compile(breezy_runtime* runtime, const char* source) {
+        if (!runtime || !source) {
+            return nullptr;
+        }
+        auto program = runtime->instance.compile(source);
+        if (!program) {
+            return nullptr;
+        }
+        return new breezy_program{ std::move(program) };
+    }
+
+    int breezy_execute(breezy_runtime* runtime, const breezy_program* program) {
+        if (!runtime || !program) {
+            return -1;
+        }
+        return runtime->instance.execute(*program->program) ? 0 : -1;
     }
 
-    void breezy_runtime_run_string(const char* code) {
-        if (g_runtime) {
-            g_runtime->run_string(code);
+    void breezy_program_free(breezy_program* program) {
+        delete program;
+    }
+
+    int breezy_runtime_get_stats(const breezy_runtime* runtime, breezy_stats* stats) {
+        if (!runtime || !stats || !breezy::runtime::stats_enabled) {
+            return -1;
+        }
+
+        const breezy::runtime::RuntimeStats& totals = runtime->instance.stats();
+        stats->bytes_lexed = totals.bytes_lexed;
+        stats->tokens_lexed = totals.tokens_lexed;
+        stats->ast_nodes = totals.ast_nodes;
+        stats->statements_executed = totals.statements_executed;
+        stats->instructions_executed = totals.instructions_executed;
+        stats->variable_lookups = totals.variable_lookups;
+        stats->native_calls = totals.native_calls;
+        stats->allocations = totals.allocations;
+        stats->allocated_bytes = totals.allocated_bytes;
+        stats->parse_seconds = totals.parse_seconds;
+        stats->resolve_seconds = totals.resolve_seconds;
+        stats->optimize_seconds = totals.optimize_seconds;
+        stats->compile_seconds = totals.compile_seconds;
+        stats->load_seconds = totals.load_seconds;
+        stats->execute_seconds = totals.execute_seconds;
+        return 0;
+    }
+
+    void breezy_runtime_reset_stats(breezy_runtime* runtime) {
+        if (runtime) {
+            runtime->instance.clear_stats();
         }
     }
 
-    void breezy_runtime_run_file(const char* filepath) {
-        if (g_runtime) {
-            g_runtime->run_file(filepath);
+    void breezy_runtime_set_profiling(breezy_runtime* runtime, unsigned samples_per_second) {
+        if (!runtime) {
+            return;
+        }
+        runtime->profile.clear();
+        if (samples_per_second > 0) {
+            runtime->instance.enable_profiling(samples_per_second);
+        }
+        else {
+            runtime->instance.disable_profiling();
+        }
+    }
+
+    size_t breezy_runtime_get_profile(breezy_runtime* runtime, const breezy_profile_entry** entries) {
+        if (!runtime || !entries) {
+            return 0;
+        }
+
+        runtime->profile.clear();
+        if (const breezy::runtime::SamplingProfiler* profiler = runtime->instance.profiler()) {
+            for (const breezy::runtime::ProfileEntry& entry : profiler->entries()) {
+                runtime->profile.push_back({
+                    entry.script.c_str(),
+                    breezy::runtime::phase_name(entry.phase),
+                    entry.line,
+                    entry.native.empty() ? nullptr : entry.native.c_str(),
+                    entry.samples
+                });
+            }
+        }
+        *entries = runtime->profile.data();
+        return runtime->profile.size();
+    }
+
+    void breezy_runtime_set_tracing(breezy_runtime* runtime, size_t capacity) {
+        if (!runtime) {
+            return;
+        }
+        runtime->trace.clear();
+        if (capacity > 0) {
+            runtime->instance.enable_tracing(capacity);
+        }
+        else {
+            runtime->instance.disable_tracing();
+        }
+    }
+
+    size_t breezy_runtime_get_trace(breezy_runtime* runtime, const breezy_trace_event** events) {
+        if (!runtime || !events) {
+            return 0;
+        }
+
+        runtime->trace.clear();
+        if (const breezy::runtime::TraceBuffer* trace = runtime->instance.trace()) {
+            runtime->trace.reserve(trace->size());
+            trace->for_each([&](const breezy::runtime::TraceEvent& event) {
+                runtime->trace.push_back({
+                    event.name.data(),
+                    event.name.size(),
+                    event.category,
+                    event.start_ns,
+                    event.duration_ns,
+                    event.thread,
+                    event.line
+                });
+            });
         }
+        *events = runtime->trace.data();
+        return runtime->trace.size();
     }
 }
@@ -0,0 +1,172 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/diagnostics/sampling_profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+
+#include "breezy/frontend/line_table.hpp"
+
+namespace breezy::runtime {
+    const char* phase_name(ProfilePhase phase) {
+        switch (phase) {
+            case ProfilePhase::Load:     return "load";
+            case ProfilePhase::Parse:    return "parse";
+            case ProfilePhase::Resolve:  return "resolve";
+            case ProfilePhase::Optimize: return "optimize";
+            case ProfilePhase::Compile:  return "compile";
+            case ProfilePhase::Execute:  return "execute";
+        }
+        return "unknown";
+    }
+
+    SamplingProfiler::SamplingProfiler(unsigned samples_per_second)
+        : samples_per_second_(std::clamp(samples_per_second, 1u, max_samples_per_second)) {}
+
+    SamplingProfiler::~SamplingProfiler() {
+        stop();
+    }
+
+    void SamplingProfiler::begin_run(std::string_view script) {
+        stop();
+
+        script_.assign(script);
+        phase_ = ProfilePhase::Parse;
+        attached_ = false;
+        chunk_ = nullptr;
+        pending_.clear();
+        probe_.position.store(ExecutionProbe::none, std::memory_order_relaxed);
+        probe_.native.store(ExecutionProbe::none, std::memory_order_relaxed);
+
+        stopping_ = false;
+        sampler_ = std::thread(&SamplingProfiler::sample_loop, this);
+    }
+
+    void SamplingProfiler::set_phase(ProfilePhase phase) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        phase_ = phase;
+    }
+
+    void SamplingProfiler::attach(const Chunk* chunk) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        phase_ = ProfilePhase::Execute;
+        attached_ = true;
+        chunk_ = chunk;
+        probe_.position.store(ExecutionProbe::none, std::memory_order_relaxed);
+        probe_.native.store(ExecutionProbe::none, std::memory_order_relaxed);
+    }
+
+    void SamplingProfiler::detach() {
+        // Later samples of this phase (output flushing) are not tied to a statement
+        std::lock_guard<std::mutex> lock(mutex_);
+        attached_ = false;
+        chunk_ = nullptr;
+    }
+
+    void SamplingProfiler::end_run(const NativeRegistry& natives, std::string_view source) {
+        stop();
+
+        std::optional<LineTable> lines;
+        for (const auto& [key, samples] : pending_) {
+            auto [phase, offset, native] = key;
+
+            std::uint32_t line = 0;
+            if (offset != ExecutionProbe::none && offset < source.size()) {
+                if (!lines) lines.emplace(source);
+                line = lines->locate(offset).line;
+            }
+
+            std::string name;
+            if (native != ExecutionProbe::none && native < natives.size()) {
+                name.assign(natives[native].name);
+            }
+
+            auto index_key = std::make_tuple(script_, phase, line, name);
+            auto it = entry_indices_.find(index_key);
+            if (it == entry_indices_.end()) {
+                entry_indices_.emplace(std::move(index_key), entries_.size());
+                entries_.push_back({ script_, phase, line, std::move(name), samples });
+            }
+            else {
+                entries_[it->second].samples += samples;
+            }
+        }
+
+        pending_.clear();
+    }
+
+    void SamplingProfiler::clear() {
+        entries_.clear();
+        entry_indices_.clear();
+    }
+
+    void SamplingProfiler::sample_loop() {
+        using Clock = std::chrono::steady_clock;
+        const auto interval = std::chrono::nanoseconds(1000000000ll / samples_per_second_);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        Clock::time_point next = Clock::now() + interval;
+        while (!wake_.wait_until(lock, next, [this] { return stopping_; })) {
+            take_sample();
+
+            // After a stall, resume the cadence instead of catching up in a burst
+            next += interval;
+            Clock::time_point now = Clock::now();
+            if (next < now) next = now + interval;
+        }
+    }
+
+    void SamplingProfiler::take_sample() {
+        std::uint32_t offset = ExecutionProbe::none;
+        std::uint32_t native = ExecutionProbe::none;
+
+        if (attached_) {
+            std::uint32_t position = probe_.position.load(std::memory_order_relaxed);
+            native = probe_.native.load(std::memory_order_relaxed);
+            if (position != ExecutionProbe::none) {
+                offset = chunk_ ? source_offset(*chunk_, position) : position;
+            }
+        }
+        ++pending_[{ phase_, offset, native }];
+    }
+
+    void SamplingProfiler::stop() {
+        if (!sampler_.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        sampler_.join();
+    }
+}
@@ -0,0 +1,76 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/diagnostics/trace_buffer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <thread>
+
+#include "breezy/frontend/line_table.hpp"
+
+namespace breezy::runtime {
+    TraceBuffer::TraceBuffer(std::size_t capacity)
+        : capacity_(std::max<std::size_t>(capacity, 1)) {
+        events_.reserve(std::min<std::size_t>(capacity_, 4096));
+        begin_run();
+    }
+
+    std::uint64_t TraceBuffer::now() {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void TraceBuffer::begin_run() {
+        thread_ = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        run_start_ = recorded_;
+    }
+
+    void TraceBuffer::end_run(std::string_view source) {
+        // Only the run's events still in the ring
+        std::size_t count = std::min(recorded_ - run_start_, events_.size());
+        std::optional<LineTable> lines;
+        for (std::size_t i = recorded_ - count; i < recorded_; ++i) {
+            TraceEvent& event = events_[i % capacity_];
+            if (event.offset != none && event.offset < source.size()) {
+                if (!lines) lines.emplace(source);
+                event.line = lines->locate(event.offset).line;
+            }
+        }
+        run_start_ = recorded_;
+    }
+
+    void TraceBuffer::clear() {
+        events_.clear();
+        recorded_ = 0;
+        run_start_ = 0;
+    }
+}
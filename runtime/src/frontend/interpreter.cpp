@@ -29,53 +29,127 @@
 
 #include "breezy/frontend/interpreter.hpp"
 
-#include <iostream>
+#include <cstdint>
+#include <stdexcept>
 #include <variant>
 
+#include "breezy/frontend/operators.hpp"
+
 namespace breezy::runtime {
+    Interpreter::Interpreter(Heap& heap, const NativeRegistry& natives, OutputSink& output, std::vector<Value>& slots,
+                             RuntimeStats& stats)
+        : heap_(heap), natives_(natives), output_(output), stats_(stats), values_(slots), scope_bases_{ 0 } {}
+
+    void Interpreter::ensure_globals(std::uint32_t count) {
+        // Only called between top-level statements, when no block slots are live
+        if (values_.size() < count) values_.resize(count);
+    }
+
+    Value& Interpreter::slot(std::uint32_t depth, std::uint32_t slot) {
+        return values_[scope_bases_[scope_bases_.size() - 1 - depth] + slot];
+    }
+
     void Interpreter::execute(const Stmt& stmt) {
+        BREEZY_STAT(++stats_.statements_executed);
         std::visit([this](auto&& node) { exec_node(node); }, stmt);
     }
 
     void Interpreter::exec_node(const VarDeclStmt& stmt) {
-        double value = 0;
+        if (probe_) probe_->enter(stmt.offset);
+        Value value;
         if (stmt.initializer) {
             value = eval(*stmt.initializer);
         }
-        environment_[stmt.name] = value;
+        slot(0, stmt.slot) = value;
     }
 
     void Interpreter::exec_node(const ExprStmt& stmt) {
+        if (probe_) probe_->enter(stmt.offset);
         eval(stmt.expression);
     }
 
-    double Interpreter::eval(const Expr& expr) {
-        return std::visit([this](auto&& node) -> double { return eval_node(node); }, expr);
-    }
+    void Interpreter::exec_node(const BlockStmt& stmt) {
+        std::size_t base = values_.size();
+        scope_bases_.push_back(base);
+        values_.resize(base + stmt.slot_count);
 
-    double Interpreter::eval_node(const LiteralExpr& expr) {
-        if (std::holds_alternative<double>(expr.value)) {
-            return std::get<double>(expr.value);
+        try {
+            for (const Stmt& child : stmt.statements) {
+                execute(child);
+            }
+        }
+        catch (...) {
+            values_.resize(base);
+            scope_bases_.pop_back();
+            throw;
         }
-        // Strings not yet evaluated to numbers
-        return 0;
+
+        values_.resize(base);
+        scope_bases_.pop_back();
+    }
+
+    Value Interpreter::eval(const Expr& expr) {
+        return std::visit([this](auto&& node) -> Value { return eval_node(node); }, expr);
+    }
+
+    Value Interpreter::eval_node(const LiteralExpr& expr) {
+        return literal_value(expr, heap_);
     }
 
-    double Interpreter::eval_node(const VariableExpr& expr) {
-        auto it = environment_.find(expr.name);
-        if (it != environment_.end()) return it->second;
-        std::cerr << "Undefined variable: " << expr.name << "\n";
-        return 0;
+    Value Interpreter::eval_node(const VariableExpr& expr) {
+        BREEZY_STAT(++stats_.variable_lookups);
+        return slot(expr.depth, expr.slot);
     }
 
-    double Interpreter::eval_node(const CallExpr& expr) {
-        if (expr.callee == "print") {
+    Value Interpreter::eval_node(const CallExpr& expr) {
+        std::size_t base = arguments_.size();
+        Value result;
+
+        try {
             for (auto& arg : expr.arguments) {
-                double val = eval(arg);
-                std::cout << val << " ";
+                Value value = eval(arg);
+                arguments_.push_back(value);
             }
-            std::cout << "\n";
+
+            NativeCall call{ heap_, output_, natives_[expr.native] };
+            BREEZY_STAT(++stats_.native_calls);
+            if (probe_) probe_->enter_native(expr.native);
+            std::uint64_t start = trace_ ? TraceBuffer::now() : 0;
+            result = call.native.function(call, arguments_.data() + base, expr.arguments.size);
+            if (trace_) trace_->record(call.native.name, "native", start);
+            if (probe_) probe_->leave_native();
+        }
+        catch (...) {
+            if (probe_) probe_->leave_native();
+            arguments_.resize(base);
+            throw;
+        }
+
+        arguments_.resize(base);
+        return result;
+    }
+
+    Value Interpreter::eval_node(const UnaryExpr& expr) {
+        Value operand = eval(*expr.operand);
+        Value result;
+        if (!evaluate_unary(expr.op, operand, result)) {
+            throw std::runtime_error(operand_error(expr.op, operand));
+        }
+        return result;
+    }
+
+    Value Interpreter::eval_node(const BinaryExpr& expr) {
+        Value left = eval(*expr.left);
+
+        // Short-circuit the logical operators
+        if (expr.op == BinaryOp::And && !left.truthy()) return Value::boolean(false);
+        if (expr.op == BinaryOp::Or && left.truthy()) return Value::boolean(true);
+
+        Value right = eval(*expr.right);
+        Value result;
+        if (!evaluate_binary(expr.op, left, right, &heap_, result)) {
+            throw std::runtime_error(operand_error(expr.op, left, right));
         }
-        return 0;
+        return result;
     }
 }
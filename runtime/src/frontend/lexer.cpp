@@ -29,103 +29,191 @@
 
 #include "breezy/frontend/lexer.hpp"
 
-#include <cctype>
-#include <string>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
 #include <string_view>
-#include <vector>
 
+#include "breezy/diagnostics/runtime_stats.hpp"
+#include "breezy/frontend/char_class.hpp"
+#include "breezy/frontend/scanner.hpp"
 #include "breezy/frontend/token.hpp"
 
 namespace breezy::runtime {
-    Lexer::Lexer(std::string_view source) 
-        : source_(source) {}
+    namespace {
+        std::uint32_t two_char_symbol(char first, char second) {
+            switch (first) {
+                case '=': return second == '=' ? punct::EqualEqual : no_symbol;
+                case '!': return second == '=' ? punct::BangEqual : no_symbol;
+                case '<': return second == '=' ? punct::LessEqual : no_symbol;
+                case '>': return second == '=' ? punct::GreaterEqual : no_symbol;
+                case '&': return second == '&' ? punct::AndAnd : no_symbol;
+                case '|': return second == '|' ? punct::OrOr : no_symbol;
+                default:  return no_symbol;
+            }
+        }
+
+        std::uint32_t checked_length(std::size_t length) {
+            if (length > Token::max_length) {
+                throw std::runtime_error("Token exceeds the 16 MiB limit.");
+            }
+            return static_cast<std::uint32_t>(length);
+        }
+    }
+
+    Lexer::Lexer(std::string_view source, SymbolTable& symbols) 
+        : source_(source), symbols_(symbols) {
+        if (source_.size() >= std::numeric_limits<std::uint32_t>::max()) {
+            throw std::runtime_error("Source exceeds the 4 GiB limit.");
+        }
+    }
     
-    std::vector<Token> Lexer::tokenize() {
-        std::vector<Token> tokens;
+    TokenList Lexer::tokenize() {
+        TokenList tokens(source_);
+        tokens.reserve(source_.size() / 4);
+
+        Token token;
+        do {
+            token = scan_token();
+            BREEZY_STAT(++token_count_);
+            tokens.push_back(token);
+        } while (token.type() != TokenType::EndOfFile);
+
+        return tokens;
+    }
+
+    Token Lexer::next_token() {
+        if (ring_count_ == 0) {
+            BREEZY_STAT(++token_count_);
+            return scan_token();
+        }
+
+        Token token = ring_[ring_head_];
+        ring_head_ = (ring_head_ + 1) % lookahead_capacity;
+        --ring_count_;
+        return token;
+    }
+
+    const Token& Lexer::peek_token(std::size_t ahead) {
+        assert(ahead < lookahead_capacity && "Lookahead exceeds the ring capacity");
+
+        while (ring_count_ <= ahead) {
+            ring_[(ring_head_ + ring_count_) % lookahead_capacity] = scan_token();
+            BREEZY_STAT(++token_count_);
+            ++ring_count_;
+        }
+        return ring_[(ring_head_ + ahead) % lookahead_capacity];
+    }
+
+    Token Lexer::scan_token() {
+        const char* data = source_.data();
+        const char* end = data + source_.size();
 
         while (!is_at_end()) {
             skip_white_space();
             if (is_at_end()) break;
 
-            std::size_t token_start = position_;
-            std::uint32_t token_line = line_;
-            std::uint32_t token_column = column_;
+            auto token_start = static_cast<std::uint32_t>(position_);
 
-            char c = peek();
+            char c = data[position_];
+            std::uint8_t cls = char_class_table[static_cast<unsigned char>(c)];
 
             // Identifiers / Keywords
-            if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
-                // Use peek() and guard with is_at_end()
-                while (!is_at_end() && (std::isalnum(static_cast<unsigned char>(peek())) || peek() == '_')) {
-                    advance();
-                }
-                std::string_view lex = source_.substr(token_start, position_ - token_start);
-
-                TokenType type = TokenType::Identifier;
-                if (is_keyword(lex)) {
-                    type = TokenType::Keyword;
+            if (cls & CharIdentStart) {
+                position_ = scanner::skip_identifier(data + position_ + 1, end) - data;
+                std::uint32_t length = checked_length(position_ - token_start);
+                std::string_view lex = source_.substr(token_start, length);
+
+                SymbolId keyword = keyword_symbol(lex);
+                if (keyword != no_symbol) {
+                    return {TokenType::Keyword, token_start, length, keyword};
                 }
-
-                tokens.push_back({type, lex, token_line, token_column});
-                continue;
+                return {TokenType::Identifier, token_start, length, symbols_.intern(lex)};
             }
 
-            // Numbers (integers only for now)
-            if (std::isdigit(static_cast<unsigned char>(c))) {
-                while (!is_at_end() && std::isdigit(static_cast<unsigned char>(peek()))) {
-                    advance();
-                }
-                std::string_view lex = source_.substr(token_start, position_ - token_start);
-                tokens.push_back({TokenType::Number, lex, token_line, token_column});
-                continue;
+            // Numbers
+            if (cls & CharDigit) {
+                return scan_number(token_start);
             }
 
             // Strings (include quotes in lexeme for now)
-            if (c == '"') {
-                // consume opening quote
-                advance();
-                while (!is_at_end() && peek() != '"') {
-                    // simple escape handling could be added later
-                    advance();
-                }
-                // consume closing quote if present
-                if (!is_at_end() && peek() == '"') advance();
-                std::string_view lex = source_.substr(token_start, position_ - token_start);
-                tokens.push_back({TokenType::String, lex, token_line, token_column});
-                continue;
+            if (cls & CharQuote) {
+                // consume the body and the closing quote if present
+                std::size_t close = scanner::find_quote(data + position_ + 1, end) - data;
+                position_ = close < source_.size() ? close + 1 : close;
+                return {TokenType::String, token_start, checked_length(position_ - token_start), no_symbol};
             }
 
-            // Symbols (single-char for now)
-            const std::string symbols = "+-*/=;(){}[],.";
-            if (symbols.find(c) != std::string::npos) {
-                advance();
-                std::string_view lex = source_.substr(token_start, 1);
-                tokens.push_back({TokenType::Symbol, lex, token_line, token_column});
-                continue;
+            // Symbols
+            if (cls & CharSymbol) {
+                std::uint32_t symbol = static_cast<unsigned char>(c);
+                std::uint32_t length = 1;
+
+                if (position_ + 1 < source_.size()) {
+                    std::uint32_t pair = two_char_symbol(c, data[position_ + 1]);
+                    if (pair != no_symbol) {
+                        symbol = pair;
+                        length = 2;
+                    }
+                }
+
+                position_ += length;
+                return {TokenType::Symbol, token_start, length, symbol};
             }
 
             // Unknown / skip character
-            advance();
+            ++position_;
         }
 
-        tokens.push_back({TokenType::EndOfFile, std::string_view(), line_, column_});
-        return tokens;
+        return {TokenType::EndOfFile, static_cast<std::uint32_t>(position_), 0, no_symbol};
     }
 
-    char Lexer::peek() const {
-        return is_at_end() ? '\0' : source_[position_];
+    Token Lexer::scan_number(std::uint32_t start) {
+        const char* data = source_.data();
+        const char* end = data + source_.size();
+        const char* it = data + start;
+        TokenType type = TokenType::Integer;
+
+        if (it[0] == '0' && it + 1 < end && ((it[1] | 0x20) == 'x' || (it[1] | 0x20) == 'b')) {
+            // Hex / binary: take the whole digit-and-separator run, the parser validates it
+            it += 2;
+            while (it < end && (has_char_class(*it, CharHexDigit) || *it == '_')) ++it;
+        }
+        else {
+            it = skip_digit_run(it);
+
+            // Fraction: only when a digit follows the '.'
+            if (it + 1 < end && it[0] == '.' && has_char_class(it[1], CharDigit)) {
+                it = skip_digit_run(it + 1);
+                type = TokenType::Float;
+            }
+
+            // Exponent: only when digits follow the (optionally signed) 'e'
+            if (it < end && (*it | 0x20) == 'e') {
+                const char* exponent = it + 1;
+                if (exponent < end && (*exponent == '+' || *exponent == '-')) ++exponent;
+                if (exponent < end && has_char_class(*exponent, CharDigit)) {
+                    it = skip_digit_run(exponent);
+                    type = TokenType::Float;
+                }
+            }
+        }
+
+        position_ = it - data;
+        return {type, start, checked_length(position_ - start), no_symbol};
     }
 
-    char Lexer::advance() {
-        if (is_at_end()) return '\0';
-        char c = source_[position_++];
-        if (c == '\n') {
-            ++line_;
-            column_ = 1;
-        } else {
-            ++column_;
+    const char* Lexer::skip_digit_run(const char* it) const {
+        // Digits with '_' separators
+        const char* end = source_.data() + source_.size();
+        for (;;) {
+            it = scanner::skip_digits(it, end);
+            if (it < end && *it == '_') {
+                ++it;
+                continue;
+            }
+            return it;
         }
-        return c;
     }
 
     bool Lexer::is_at_end() const {
@@ -133,13 +221,7 @@ namespace breezy::runtime {
     }
 
     void Lexer::skip_white_space() {
-        while (!is_at_end() && std::isspace(static_cast<unsigned char>(peek()))) advance();
-    }
-
-    bool Lexer::is_keyword(std::string_view lexeme) {
-        for (auto kw : keywords_) {
-            if (lexeme == kw) return true;
-        }
-        return false;
+        const char* data = source_.data();
+        position_ = scanner::skip_whitespace(data + position_, data + source_.size()) - data;
     }
-}
+}
\ No newline at end of file
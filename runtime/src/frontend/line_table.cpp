@@ -0,0 +1,63 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/frontend/line_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace breezy::runtime {
+    LineTable::LineTable(std::string_view source) {
+        line_starts_.push_back(0);
+
+        const char* data = source.data();
+        std::size_t position = 0;
+        while (position < source.size()) {
+            const void* nl = std::memchr(data + position, '\n', source.size() - position);
+            if (!nl) break;
+            position = static_cast<const char*>(nl) - data + 1;
+            line_starts_.push_back(static_cast<std::uint32_t>(position));
+        }
+    }
+
+    SourceLocation LineTable::locate(std::uint32_t offset) const {
+        // Last line start that is <= offset
+        auto it = std::upper_bound(line_starts_.begin(), line_starts_.end(), offset) - 1;
+        auto line = static_cast<std::uint32_t>(it - line_starts_.begin()) + 1;
+        return { line, offset - *it + 1 };
+    }
+
+    std::string LineTable::format(std::uint32_t offset, std::string_view message) const {
+        SourceLocation loc = locate(offset);
+        std::string result = "[line " + std::to_string(loc.line) + ":" + std::to_string(loc.column) + "] ";
+        result.append(message);
+        return result;
+    }
+}
@@ -0,0 +1,133 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/frontend/number_literal.hpp"
+
+#include <charconv>
+#include <limits>
+#include <system_error>
+
+namespace breezy::runtime {
+    namespace {
+        constexpr std::size_t max_stripped_length = 256;
+
+        int digit_value(char c) {
+            if (c >= '0' && c <= '9') return c - '0';
+            c = static_cast<char>(c | 0x20);
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            return 99;
+        }
+
+        // Hex / binary digits with separators. Rejects empty bodies and misplaced '_'.
+        bool parse_radix(std::string_view digits, unsigned radix, NumberLiteral& out) {
+            if (digits.empty() || digits.front() == '_' || digits.back() == '_') return false;
+
+            std::uint64_t value = 0;
+            char previous = 0;
+            for (char c : digits) {
+                if (c == '_') {
+                    if (previous == '_') return false;
+                    previous = c;
+                    continue;
+                }
+                previous = c;
+
+                int digit = digit_value(c);
+                if (digit >= static_cast<int>(radix)) return false;
+                if (value > (std::numeric_limits<std::uint64_t>::max() - digit) / radix) return false;
+                value = value * radix + static_cast<unsigned>(digit);
+            }
+
+            if (value > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())) return false;
+
+            out.is_integer = true;
+            out.integer = static_cast<std::int64_t>(value);
+            out.number = static_cast<double>(out.integer);
+            return true;
+        }
+
+        // Copies `text` without separators into `buffer`, checking that each '_' sits
+        // between two digits. Returns the stripped length, or 0 on failure.
+        std::size_t strip_separators(std::string_view text, char* buffer) {
+            std::size_t length = 0;
+            for (std::size_t i = 0; i < text.size(); ++i) {
+                char c = text[i];
+                if (c == '_') {
+                    bool digit_before = i > 0 && text[i - 1] >= '0' && text[i - 1] <= '9';
+                    bool digit_after = i + 1 < text.size() && text[i + 1] >= '0' && text[i + 1] <= '9';
+                    if (!digit_before || !digit_after) return 0;
+                    continue;
+                }
+                buffer[length++] = c;
+            }
+            return length;
+        }
+    }
+
+    bool parse_number_literal(std::string_view text, NumberLiteral& out) {
+        if (text.size() > 2 && text[0] == '0') {
+            char prefix = static_cast<char>(text[1] | 0x20);
+            if (prefix == 'x') return parse_radix(text.substr(2), 16, out);
+            if (prefix == 'b') return parse_radix(text.substr(2), 2, out);
+        }
+
+        char buffer[max_stripped_length];
+        if (text.find('_') != std::string_view::npos) {
+            if (text.size() > max_stripped_length) return false;
+            std::size_t length = strip_separators(text, buffer);
+            if (length == 0) return false;
+            text = std::string_view(buffer, length);
+        }
+
+        const char* first = text.data();
+        const char* last = first + text.size();
+        bool is_float = text.find_first_of(".eE") != std::string_view::npos;
+
+        if (!is_float) {
+            std::int64_t integer = 0;
+            auto [ptr, ec] = std::from_chars(first, last, integer);
+            if (ec == std::errc() && ptr == last) {
+                out.is_integer = true;
+                out.integer = integer;
+                out.number = static_cast<double>(integer);
+                return true;
+            }
+            if (ec != std::errc::result_out_of_range) return false;
+            // Too large for int64: fall through and keep it as a float
+        }
+
+        double number = 0.0;
+        auto [ptr, ec] = std::from_chars(first, last, number);
+        if (ec != std::errc() || ptr != last) return false;
+
+        out.is_integer = false;
+        out.number = number;
+        return true;
+    }
+}
@@ -0,0 +1,198 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/frontend/operators.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include "breezy/memory/heap.hpp"
+
+namespace breezy::runtime {
+    namespace {
+        const char* symbol(UnaryOp op) {
+            return op == UnaryOp::Negate ? "-" : "!";
+        }
+
+        const char* symbol(BinaryOp op) {
+            switch (op) {
+                case BinaryOp::Add:          return "+";
+                case BinaryOp::Subtract:     return "-";
+                case BinaryOp::Multiply:     return "*";
+                case BinaryOp::Divide:       return "/";
+                case BinaryOp::Modulo:       return "%";
+                case BinaryOp::Less:         return "<";
+                case BinaryOp::LessEqual:    return "<=";
+                case BinaryOp::Greater:      return ">";
+                case BinaryOp::GreaterEqual: return ">=";
+                case BinaryOp::Equal:        return "==";
+                case BinaryOp::NotEqual:     return "!=";
+                case BinaryOp::And:          return "&&";
+                case BinaryOp::Or:           return "||";
+            }
+            return "?";
+        }
+
+        template <typename Compare>
+        bool compare(Value left, Value right, Compare cmp, Value& out) {
+            if (left.is_int() && right.is_int()) {
+                out = Value::boolean(cmp(left.as_int(), right.as_int()));
+                return true;
+            }
+            if (left.is_number() && right.is_number()) {
+                out = Value::boolean(cmp(left.to_double(), right.to_double()));
+                return true;
+            }
+            if (left.is_string() && right.is_string()) {
+                out = Value::boolean(cmp(left.as_string()->view().compare(right.as_string()->view()), 0));
+                return true;
+            }
+            return false;
+        }
+    }
+
+    bool evaluate_unary(UnaryOp op, Value operand, Value& out) {
+        switch (op) {
+            case UnaryOp::Negate:
+                if (operand.is_int()) {
+                    out = Value::from_int64(-static_cast<std::int64_t>(operand.as_int()));
+                    return true;
+                }
+                if (operand.is_double()) {
+                    out = Value::number(-operand.as_double());
+                    return true;
+                }
+                return false;
+            case UnaryOp::Not:
+                out = Value::boolean(!operand.truthy());
+                return true;
+        }
+        return false;
+    }
+
+    bool evaluate_binary(BinaryOp op, Value left, Value right, Heap* heap, Value& out) {
+        bool ints = left.is_int() && right.is_int();
+        bool numbers = left.is_number() && right.is_number();
+        std::int64_t a = ints ? left.as_int() : 0;
+        std::int64_t b = ints ? right.as_int() : 0;
+
+        switch (op) {
+            case BinaryOp::Add:
+                if (ints) { out = Value::from_int64(a + b); return true; }
+                if (numbers) { out = Value::number(left.to_double() + right.to_double()); return true; }
+                if (heap && left.is_string() && right.is_string()) {
+                    out = Value::object(heap->concat(left.as_string(), right.as_string()));
+                    return true;
+                }
+                return false;
+            case BinaryOp::Subtract:
+                if (ints) { out = Value::from_int64(a - b); return true; }
+                if (numbers) { out = Value::number(left.to_double() - right.to_double()); return true; }
+                return false;
+            case BinaryOp::Multiply:
+                if (ints) { out = Value::from_int64(a * b); return true; }
+                if (numbers) { out = Value::number(left.to_double() * right.to_double()); return true; }
+                return false;
+            case BinaryOp::Divide:
+                if (numbers) { out = Value::number(left.to_double() / right.to_double()); return true; }
+                return false;
+            case BinaryOp::Modulo:
+                if (ints && b != 0) { out = Value::from_int64(a % b); return true; }
+                if (numbers) { out = Value::number(std::fmod(left.to_double(), right.to_double())); return true; }
+                return false;
+            case BinaryOp::Less:         return compare(left, right, [](auto x, auto y) { return x < y; }, out);
+            case BinaryOp::LessEqual:    return compare(left, right, [](auto x, auto y) { return x <= y; }, out);
+            case BinaryOp::Greater:      return compare(left, right, [](auto x, auto y) { return x > y; }, out);
+            case BinaryOp::GreaterEqual: return compare(left, right, [](auto x, auto y) { return x >= y; }, out);
+            case BinaryOp::Equal:
+                out = Value::boolean(values_equal(left, right));
+                return true;
+            case BinaryOp::NotEqual:
+                out = Value::boolean(!values_equal(left, right));
+                return true;
+            case BinaryOp::And:
+                out = Value::boolean(left.truthy() && right.truthy());
+                return true;
+            case BinaryOp::Or:
+                out = Value::boolean(left.truthy() || right.truthy());
+                return true;
+        }
+        return false;
+    }
+
+    Value literal_value(const LiteralExpr& literal, Heap& heap) {
+        Value value;
+        constant_value(literal, &heap, value);
+        return value;
+    }
+
+    bool constant_value(const LiteralExpr& literal, Heap* heap, Value& out) {
+        return std::visit([heap, &out](auto&& value) -> bool {
+            using T = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<T, double>) out = Value::number(value);
+            else if constexpr (std::is_same_v<T, std::int64_t>) out = Value::from_int64(value);
+            else if constexpr (std::is_same_v<T, std::string_view>) {
+                if (!heap) return false;
+                out = Value::object(heap->intern(value));
+            }
+            else if constexpr (std::is_same_v<T, bool>) out = Value::boolean(value);
+            else out = Value::nil();
+            return true;
+        }, literal.value);
+    }
+
+    bool constant_literal(Value value, Arena* arena, LiteralExpr& out) {
+        if (value.is_int()) out = LiteralExpr{ static_cast<std::int64_t>(value.as_int()) };
+        else if (value.is_double()) out = LiteralExpr{ value.as_double() };
+        else if (value.is_bool()) out = LiteralExpr{ value.as_bool() };
+        else if (value.is_nil()) out = LiteralExpr{ std::monostate{} };
+        else if (arena && value.is_string()) {
+            std::string_view text = value.as_string()->view();
+            char* copy = static_cast<char*>(arena->allocate(text.size(), 1));
+            std::memcpy(copy, text.data(), text.size());
+            out = LiteralExpr{ std::string_view(copy, text.size()) };
+        }
+        else return false;
+        return true;
+    }
+
+    std::string operand_error(UnaryOp op, Value operand) {
+        return std::string("Operand of '") + symbol(op) + "' must be a number, got " + type_name(operand) + ".";
+    }
+
+    std::string operand_error(BinaryOp op, Value left, Value right) {
+        return std::string("Unsupported operands for '") + symbol(op) + "': "
+             + type_name(left) + " and " + type_name(right) + ".";
+    }
+}
@@ -0,0 +1,254 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/frontend/optimizer.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+
+#include "breezy/frontend/operators.hpp"
+
+namespace breezy::runtime {
+    namespace {
+        // Evaluating `expr` can neither print nor raise an error.
+        bool inert(const Expr& expr) {
+            return std::visit([](auto&& node) -> bool {
+                using T = std::decay_t<decltype(node)>;
+
+                if constexpr (std::is_same_v<T, LiteralExpr> || std::is_same_v<T, VariableExpr>) {
+                    return true;
+                }
+                else if constexpr (std::is_same_v<T, UnaryExpr>) {
+                    return node.op == UnaryOp::Not && inert(*node.operand);
+                }
+                else if constexpr (std::is_same_v<T, BinaryExpr>) {
+                    switch (node.op) {
+                        case BinaryOp::Equal:
+                        case BinaryOp::NotEqual:
+                        case BinaryOp::And:
+                        case BinaryOp::Or:
+                            return inert(*node.left) && inert(*node.right);
+                        default:
+                            return false;   // fails on operands of the wrong type
+                    }
+                }
+                else {
+                    return false;
+                }
+            }, expr);
+        }
+    }
+
+    Optimizer::Optimizer(const NativeRegistry& natives, OutputSink& output)
+        : natives_(natives), output_(output) {}
+
+    void Optimizer::optimize(CompilationUnit& unit, std::uint32_t global_count, bool globals_escape) {
+        arena_ = &unit.arena;
+        globals_escape_ = globals_escape;
+        scope_bases_.assign(1, 0);
+
+        constants_.assign(global_count, std::nullopt);
+        for (Stmt& stmt : unit.statements) {
+            propagate(stmt);
+        }
+
+        live_.assign(global_count, false);
+        std::size_t kept = sweep(unit.statements.data(), unit.statements.size());
+        unit.statements.erase(unit.statements.begin() + static_cast<std::ptrdiff_t>(kept), unit.statements.end());
+
+        heap_.reset();
+    }
+
+    void Optimizer::propagate(Stmt& stmt) {
+        std::visit([this](auto&& node) {
+            using T = std::decay_t<decltype(node)>;
+
+            if constexpr (std::is_same_v<T, VarDeclStmt>) {
+                if (node.initializer) fold(*node.initializer);
+
+                std::optional<LiteralExpr>& known = constants_[variable(0, node.slot)];
+                if (!node.initializer) {
+                    known = LiteralExpr{ std::monostate{} };
+                }
+                else if (auto* literal = std::get_if<LiteralExpr>(node.initializer)) {
+                    known = *literal;
+                }
+                else {
+                    known.reset();
+                }
+            }
+            else if constexpr (std::is_same_v<T, ExprStmt>) {
+                fold(node.expression);
+            }
+            else {
+                std::size_t base = constants_.size();
+                scope_bases_.push_back(base);
+                constants_.resize(base + node.slot_count);
+                for (Stmt& child : node.statements) {
+                    propagate(child);
+                }
+                constants_.resize(base);
+                scope_bases_.pop_back();
+            }
+        }, stmt);
+    }
+
+    void Optimizer::fold(Expr& expr) {
+        if (auto* read = std::get_if<VariableExpr>(&expr)) {
+            if (const std::optional<LiteralExpr>& known = constants_[variable(read->depth, read->slot)]) {
+                expr = *known;
+            }
+        }
+        else if (auto* call = std::get_if<CallExpr>(&expr)) {
+            for (Expr& arg : call->arguments) fold(arg);
+            fold_call(expr, *call);
+        }
+        else if (auto* unary = std::get_if<UnaryExpr>(&expr)) {
+            fold(*unary->operand);
+
+            auto* operand = std::get_if<LiteralExpr>(unary->operand);
+            Value value, result;
+            LiteralExpr folded;
+            if (operand && constant_value(*operand, &heap_, value) && evaluate_unary(unary->op, value, result)
+                && constant_literal(result, arena_, folded)) {
+                expr = folded;
+            }
+        }
+        else if (auto* binary = std::get_if<BinaryExpr>(&expr)) {
+            fold(*binary->left);
+            fold(*binary->right);
+
+            auto* lhs = std::get_if<LiteralExpr>(binary->left);
+            auto* rhs = std::get_if<LiteralExpr>(binary->right);
+            Value a, b, result;
+            LiteralExpr folded;
+            if (!lhs || !constant_value(*lhs, &heap_, a)) return;
+
+            // The right side of a decided '&&' / '||' is never evaluated
+            if ((binary->op == BinaryOp::And && !a.truthy()) || (binary->op == BinaryOp::Or && a.truthy())) {
+                expr = LiteralExpr{ binary->op == BinaryOp::Or };
+                return;
+            }
+            if (rhs && constant_value(*rhs, &heap_, b) && evaluate_binary(binary->op, a, b, &heap_, result)
+                && constant_literal(result, arena_, folded)) {
+                expr = folded;
+            }
+        }
+    }
+
+    void Optimizer::fold_call(Expr& expr, const CallExpr& call) {
+        const Native& native = natives_[call.native];
+        if (!native.pure) return;
+
+        arguments_.clear();
+        for (const Expr& arg : call.arguments) {
+            auto* literal = std::get_if<LiteralExpr>(&arg);
+            Value value;
+            if (!literal || !constant_value(*literal, &heap_, value)) return;
+            arguments_.push_back(value);
+        }
+
+        try {
+            NativeCall context{ heap_, output_, native };
+            Value result = native.function(context, arguments_.data(), static_cast<std::uint32_t>(arguments_.size()));
+
+            LiteralExpr folded;
+            if (constant_literal(result, arena_, folded)) expr = folded;
+        }
+        catch (const std::runtime_error&) {
+            // Left for the engine to raise when the call runs
+        }
+    }
+
+    std::size_t Optimizer::sweep(Stmt* statements, std::size_t count) {
+        // Whether a store is dead depends on what runs after it
+        std::size_t first = count;
+        for (std::size_t i = count; i-- > 0;) {
+            if (keep(statements[i])) statements[--first] = statements[i];
+        }
+        std::move(statements + first, statements + count, statements);
+        return count - first;
+    }
+
+    bool Optimizer::keep(Stmt& stmt) {
+        return std::visit([this](auto&& node) -> bool {
+            using T = std::decay_t<decltype(node)>;
+
+            if constexpr (std::is_same_v<T, VarDeclStmt>) {
+                std::size_t index = variable(0, node.slot);
+                bool escapes = globals_escape_ && scope_bases_.size() == 1;
+                if (!live_[index] && !escapes && (!node.initializer || inert(*node.initializer))) {
+                    return false;
+                }
+
+                // Reads before this declaration see an earlier store, unless the
+                // initializer fails and the variable keeps that store
+                if (!node.initializer || inert(*node.initializer)) live_[index] = false;
+                if (node.initializer) mark_reads(*node.initializer);
+                return true;
+            }
+            else if constexpr (std::is_same_v<T, ExprStmt>) {
+                if (inert(node.expression)) return false;
+                mark_reads(node.expression);
+                return true;
+            }
+            else {
+                std::size_t base = live_.size();
+                scope_bases_.push_back(base);
+                live_.resize(base + node.slot_count, false);
+                node.statements.size = static_cast<std::uint32_t>(sweep(node.statements.data, node.statements.size));
+                live_.resize(base);
+                scope_bases_.pop_back();
+                return !node.statements.empty();
+            }
+        }, stmt);
+    }
+
+    void Optimizer::mark_reads(const Expr& expr) {
+        std::visit([this](auto&& node) {
+            using T = std::decay_t<decltype(node)>;
+
+            if constexpr (std::is_same_v<T, VariableExpr>) {
+                live_[variable(node.depth, node.slot)] = true;
+            }
+            else if constexpr (std::is_same_v<T, CallExpr>) {
+                for (const Expr& arg : node.arguments) mark_reads(arg);
+            }
+            else if constexpr (std::is_same_v<T, UnaryExpr>) {
+                mark_reads(*node.operand);
+            }
+            else if constexpr (std::is_same_v<T, BinaryExpr>) {
+                mark_reads(*node.left);
+                mark_reads(*node.right);
+            }
+        }, expr);
+    }
+}
@@ -29,19 +29,62 @@
 
 #include "breezy/frontend/parser.hpp"
 
-#include <memory>
+#include <array>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <utility>
+#include <variant>
 #include <vector>
 
+#include "breezy/diagnostics/runtime_stats.hpp"
 #include "breezy/frontend/ast.hpp"
+#include "breezy/frontend/line_table.hpp"
+#include "breezy/frontend/number_literal.hpp"
+#include "breezy/frontend/operators.hpp"
 #include "breezy/frontend/token.hpp"
+#include "breezy/vm/value.hpp"
 
 namespace breezy::runtime {
-    Parser::Parser(const std::vector<Token>& tokens)
-        : tokens_(tokens) {}
+    namespace {
+        struct InfixRule {
+            BinaryOp op;
+            int precedence; // 0: not an infix operator
+        };
+
+        constexpr std::array<InfixRule, punct::count> make_infix_rules() {
+            std::array<InfixRule, punct::count> rules{};
+
+            rules[punct::OrOr]         = { BinaryOp::Or, 1 };
+            rules[punct::AndAnd]       = { BinaryOp::And, 2 };
+            rules[punct::EqualEqual]   = { BinaryOp::Equal, 3 };
+            rules[punct::BangEqual]    = { BinaryOp::NotEqual, 3 };
+            rules['<']                 = { BinaryOp::Less, 4 };
+            rules[punct::LessEqual]    = { BinaryOp::LessEqual, 4 };
+            rules['>']                 = { BinaryOp::Greater, 4 };
+            rules[punct::GreaterEqual] = { BinaryOp::GreaterEqual, 4 };
+            rules['+']                 = { BinaryOp::Add, 5 };
+            rules['-']                 = { BinaryOp::Subtract, 5 };
+            rules['*']                 = { BinaryOp::Multiply, 6 };
+            rules['/']                 = { BinaryOp::Divide, 6 };
+            rules['%']                 = { BinaryOp::Modulo, 6 };
+            return rules;
+        }
+
+        constexpr std::array<InfixRule, punct::count> infix_rules = make_infix_rules();
+
+        const InfixRule* infix_rule(const Token& token) {
+            if (token.type() != TokenType::Symbol) return nullptr;
+            const InfixRule& rule = infix_rules[token.symbol];
+            return rule.precedence ? &rule : nullptr;
+        }
+    }
+
+    Parser::Parser(const TokenList& tokens, Arena& arena)
+        : arena_(arena), tokens_(&tokens), source_(tokens.source()) {}
+
+    Parser::Parser(Lexer& lexer, Arena& arena)
+        : arena_(arena), lexer_(&lexer), source_(lexer.source()) {}
 
     std::vector<Stmt> Parser::parse() {
         std::vector<Stmt> statements;
@@ -52,115 +95,248 @@ namespace breezy::runtime {
     }
 
     Stmt Parser::statement() {
-        if (match(TokenType::Keyword, "var")) {
-            return var_declaration();
+        BREEZY_STAT(++node_count_);
+        std::uint32_t offset = peek().offset;
+        if (match(TokenType::Keyword, symbols::Var)) {
+            return var_declaration(offset);
+        }
+        if (match(TokenType::Symbol, '{')) {
+            return block(offset);
         }
-        return expr_statement();
+        return expr_statement(offset);
     }
 
-    Stmt Parser::var_declaration() {
+    Stmt Parser::block(std::uint32_t offset) {
+        std::size_t mark = stmt_scratch_.size();
+        while (!check(TokenType::Symbol, '}')) {
+            if (is_at_end()) throw error(peek(), "Expected '}' after block.");
+            Stmt stmt = statement();
+            stmt_scratch_.push_back(stmt);
+        }
+        advance(); // Consume '}'
+
+        ArenaSpan<Stmt> statements = arena_.make_span(stmt_scratch_.data() + mark, stmt_scratch_.size() - mark);
+        stmt_scratch_.resize(mark);
+        return BlockStmt{ statements, offset };
+    }
+
+    Stmt Parser::var_declaration(std::uint32_t offset) {
         Token name = consume(TokenType::Identifier, "Expected variable name after 'var'.");
 
-        std::unique_ptr<Expr> initializer = nullptr;
+        Expr* initializer = nullptr;
 
-        if (match(TokenType::Symbol, "=")) {
-            initializer = std::make_unique<Expr>(expression());
+        if (match(TokenType::Symbol, '=')) {
+            initializer = arena_.make<Expr>(expression());
         }
 
-        match(TokenType::Symbol, ";");
+        match(TokenType::Symbol, ';');
 
-        return VarDeclStmt{ name.lexeme, std::move(initializer) };
+        return VarDeclStmt{ name.symbol, initializer, offset };
     }
 
-    Stmt Parser::expr_statement() {
+    Stmt Parser::expr_statement(std::uint32_t offset) {
         Expr expr = expression();
-        match(TokenType::Symbol, ";");
-        return ExprStmt{ std::move(expr) };
+        match(TokenType::Symbol, ';');
+        return ExprStmt{ expr, offset };
     }
 
     Expr Parser::expression() {
+        return binary(0);
+    }
+
+    Expr Parser::binary(int min_precedence) {
+        Expr left = unary();
+
+        for (;;) {
+            const InfixRule* rule = infix_rule(peek());
+            if (!rule || rule->precedence <= min_precedence) break;
+
+            advance();
+            // Operators are left-associative: the right side binds only tighter operators.
+            Expr right = binary(rule->precedence);
+            left = make_binary(rule->op, left, right);
+        }
+
+        return left;
+    }
+
+    Expr Parser::unary() {
+        if (match(TokenType::Symbol, '-')) {
+            return make_unary(UnaryOp::Negate, unary());
+        }
+        if (match(TokenType::Symbol, '!')) {
+            return make_unary(UnaryOp::Not, unary());
+        }
         return primary();
     }
 
     Expr Parser::primary() {
-        if (check(TokenType::Number)) {
-            Token num = advance();
-            double value = std::stod(std::string(num.lexeme));
-            return LiteralExpr{ value };
+        // Grouping
+        if (match(TokenType::Symbol, '(')) {
+            Expr inner = expression();
+            if (!match(TokenType::Symbol, ')')) {
+                throw error(peek(), "Expected ')' after expression.");
+            }
+            return inner;
         }
 
+        // Everything below is a node of its own
+        BREEZY_STAT(++node_count_);
+
+        if (check_number()) {
+            return number_literal(advance());
+        }
+
+        if (check(TokenType::String)) {
+            return string_literal(advance());
+        }
+
+        if (match(TokenType::Keyword, symbols::True)) return LiteralExpr{ true };
+        if (match(TokenType::Keyword, symbols::False)) return LiteralExpr{ false };
+        if (match(TokenType::Keyword, symbols::Nil)) return LiteralExpr{ std::monostate{} };
+
         // Identifiers or keywords (for function calls like print)
         if (check(TokenType::Identifier) || check(TokenType::Keyword)) {
             Token id = advance();
 
             // Only handle call expressions if next token is '('
-            if (check(TokenType::Symbol, "(")) {
-                advance(); // Consume '('
-
-                Expr arg;
-                if (check(TokenType::Number)) {
-                    Token num = advance();
-                    arg = LiteralExpr{ std::stod(std::string(num.lexeme)) };
-                } 
-                else if (check(TokenType::Identifier) || check(TokenType::Keyword)) {
-                    Token var = advance();
-                    arg = VariableExpr{ var.lexeme };
-                }
-                else {
-                    throw std::runtime_error("Expected expression as print argument");
-                }
-
-                // Expect closing ')'
-                if (!check(TokenType::Symbol) || peek().lexeme != ")") {
-                    throw std::runtime_error("Expected ')' after argument.");
-                }
-                advance(); // Consume ')'
-
-                return CallExpr{ id. lexeme, {arg} }; // Wrap the vector
+            if (check(TokenType::Symbol, '(')) {
+                return call(id);
             }
 
             // Otherwise, treat as variable
-            return VariableExpr{ id.lexeme };
+            return VariableExpr{ id.symbol, id.offset };
         }
 
-        throw std::runtime_error("Expected expression at token: " + std::string(peek().lexeme));
+        throw error(peek(), "Expected expression at token: " + std::string(lexeme(peek())));
     }
 
-    bool Parser::match(TokenType type, const std::string_view lexeme) {
-        if (check(type, lexeme)) {
+    Expr Parser::call(const Token& callee) {
+        advance(); // Consume '('
+
+        std::size_t mark = scratch_.size();
+        if (!check(TokenType::Symbol, ')')) {
+            do {
+                Expr arg = expression();
+                scratch_.push_back(arg);
+            } while (match(TokenType::Symbol, ','));
+        }
+
+        // Expect closing ')'
+        if (!match(TokenType::Symbol, ')')) {
+            throw error(peek(), "Expected ')' after argument.");
+        }
+
+        ArenaSpan<Expr> arguments = arena_.make_span(scratch_.data() + mark, scratch_.size() - mark);
+        scratch_.resize(mark);
+        return CallExpr{ callee.symbol, arguments, callee.offset };
+    }
+
+    Expr Parser::make_unary(UnaryOp op, const Expr& operand) {
+        BREEZY_STAT(++node_count_);
+        if (auto* literal = std::get_if<LiteralExpr>(&operand)) {
+            if (auto* integer = std::get_if<std::int64_t>(&literal->value); integer && op == UnaryOp::Negate) {
+                return LiteralExpr{ -*integer };
+            }
+            // Strings are not folded: that would need a heap at parse time
+            Value value, result;
+            LiteralExpr folded;
+            if (constant_value(*literal, nullptr, value) && evaluate_unary(op, value, result)
+                && constant_literal(result, nullptr, folded)) {
+                return folded;
+            }
+        }
+        return UnaryExpr{ op, arena_.make<Expr>(operand) };
+    }
+
+    Expr Parser::make_binary(BinaryOp op, const Expr& left, const Expr& right) {
+        BREEZY_STAT(++node_count_);
+        auto* lhs = std::get_if<LiteralExpr>(&left);
+        auto* rhs = std::get_if<LiteralExpr>(&right);
+
+        // Operations that would fail at run time are left for the evaluator to report
+        Value a, b, result;
+        LiteralExpr folded;
+        if (lhs && rhs && constant_value(*lhs, nullptr, a) && constant_value(*rhs, nullptr, b)
+            && evaluate_binary(op, a, b, nullptr, result) && constant_literal(result, nullptr, folded)) {
+            return folded;
+        }
+        return BinaryExpr{ op, arena_.make<Expr>(left), arena_.make<Expr>(right) };
+    }
+
+    Expr Parser::number_literal(const Token& token) {
+        NumberLiteral literal;
+        if (!parse_number_literal(lexeme(token), literal)) {
+            throw error(token, "Invalid numeric literal: " + std::string(lexeme(token)));
+        }
+
+        if (literal.is_integer) return LiteralExpr{ literal.integer };
+        return LiteralExpr{ literal.number };
+    }
+
+    Expr Parser::string_literal(const Token& token) {
+        std::string_view text = lexeme(token);
+        if (text.size() < 2 || text.back() != '"') {
+            throw error(token, "Unterminated string.");
+        }
+        return LiteralExpr{ text.substr(1, text.size() - 2) };
+    }
+
+    bool Parser::match(TokenType type, std::uint32_t symbol) {
+        if (check(type, symbol)) {
             advance();
             return true;
         }
         return false;
     }
 
-    bool Parser::check(TokenType type, const std::string_view lexeme) const {
+    bool Parser::check(TokenType type, std::uint32_t symbol) const {
         if (is_at_end()) return false;
         const Token& t = peek();
-        if (t.type != type) return false;
-        if (!lexeme.empty() && t.lexeme != lexeme) return false;
+        if (t.type() != type) return false;
+        if (symbol != no_symbol && t.symbol != symbol) return false;
         return true;
     }
 
+    bool Parser::check_number() const {
+        return check(TokenType::Integer) || check(TokenType::Float);
+    }
+
     Token Parser::advance() {
-        if (!is_at_end()) current_++;
+        if (!is_at_end()) {
+            if (lexer_) {
+                previous_ = lexer_->next_token();
+            }
+            else {
+                previous_ = (*tokens_)[current_++];
+            }
+        }
         return previous();
     }
 
     bool Parser::is_at_end() const {
-        return peek().type == TokenType::EndOfFile;
+        return peek().type() == TokenType::EndOfFile;
     }
 
     Token Parser::peek() const {
-        return tokens_[current_];
+        return lexer_ ? lexer_->peek_token() : (*tokens_)[current_];
     }
 
     Token Parser::previous() const {
-        return tokens_[current_ - 1];
+        return previous_;
     }
 
     Token Parser::consume(TokenType type, const std::string& message) {
         if (check(type)) return advance();
-        throw std::runtime_error(message);
+        throw error(peek(), message);
+    }
+
+    std::string_view Parser::lexeme(const Token& token) const {
+        return source_.substr(token.offset, token.length());
+    }
+
+    std::runtime_error Parser::error(const Token& token, std::string_view message) const {
+        // Diagnostics are rare; resolve the position only when one is raised.
+        return std::runtime_error(LineTable(source_).format(token.offset, message));
     }
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/frontend/resolver.hpp"
+
+#include <string>
+#include <type_traits>
+#include <variant>
+
+#include "breezy/frontend/line_table.hpp"
+
+namespace breezy::runtime {
+    Resolver::Resolver(const SymbolTable& symbols, const NativeRegistry& natives)
+        : symbols_(symbols), natives_(natives), scopes_(1) {}
+
+    void Resolver::resolve(CompilationUnit& unit, std::string_view source) {
+        source_ = source;
+        new_globals_.clear();
+
+        try {
+            for (Stmt& stmt : unit.statements) {
+                resolve_stmt(stmt);
+            }
+        }
+        catch (...) {
+            // Roll back: nothing from a unit that will not run may stay visible
+            Scope& globals = scopes_.front();
+            for (SymbolId name : new_globals_) globals.slots.erase(name);
+            globals.count -= static_cast<std::uint32_t>(new_globals_.size());
+            scopes_.resize(1);
+            throw;
+        }
+    }
+
+    void Resolver::reset() {
+        scopes_.assign(1, Scope{});
+        new_globals_.clear();
+    }
+
+    void Resolver::resolve_stmt(Stmt& stmt) {
+        std::visit([this](auto&& node) {
+            using T = std::decay_t<decltype(node)>;
+
+            if constexpr (std::is_same_v<T, VarDeclStmt>) {
+                // The initializer sees the enclosing binding, not the one being declared
+                if (node.initializer) resolve_expr(*node.initializer);
+                node.slot = declare(node.name);
+            }
+            else if constexpr (std::is_same_v<T, ExprStmt>) {
+                resolve_expr(node.expression);
+            }
+            else {
+                scopes_.emplace_back();
+                for (Stmt& child : node.statements) {
+                    resolve_stmt(child);
+                }
+                node.slot_count = scopes_.back().count;
+                scopes_.pop_back();
+            }
+        }, stmt);
+    }
+
+    void Resolver::resolve_expr(Expr& expr) {
+        std::visit([this](auto&& node) {
+            using T = std::decay_t<decltype(node)>;
+
+            if constexpr (std::is_same_v<T, VariableExpr>) {
+                for (std::size_t i = scopes_.size(); i-- > 0;) {
+                    auto it = scopes_[i].slots.find(node.name);
+                    if (it != scopes_[i].slots.end()) {
+                        node.depth = static_cast<std::uint32_t>(scopes_.size() - 1 - i);
+                        node.slot = it->second;
+                        return;
+                    }
+                }
+                throw error(node.offset, "Undefined variable '" + std::string(symbols_.name(node.name)) + "'.");
+            }
+            else if constexpr (std::is_same_v<T, CallExpr>) {
+                node.native = natives_.find(node.callee);
+                if (node.native == NativeRegistry::npos) {
+                    throw error(node.offset, "Undefined function '" + std::string(symbols_.name(node.callee)) + "'.");
+                }
+
+                int arity = natives_[node.native].arity;
+                if (arity != variadic && static_cast<std::uint32_t>(arity) != node.arguments.size) {
+                    throw error(node.offset, "'" + std::string(symbols_.name(node.callee)) + "' expects " + std::to_string(arity)
+                        + " argument(s) but got " + std::to_string(node.arguments.size) + ".");
+                }
+
+                for (Expr& arg : node.arguments) resolve_expr(arg);
+            }
+            else if constexpr (std::is_same_v<T, UnaryExpr>) {
+                resolve_expr(*node.operand);
+            }
+            else if constexpr (std::is_same_v<T, BinaryExpr>) {
+                resolve_expr(*node.left);
+                resolve_expr(*node.right);
+            }
+        }, expr);
+    }
+
+    std::uint32_t Resolver::declare(SymbolId name) {
+        Scope& scope = scopes_.back();
+        auto [it, inserted] = scope.slots.try_emplace(name, scope.count);
+        if (inserted) {
+            ++scope.count;
+            if (scopes_.size() == 1) new_globals_.push_back(name);
+        }
+        return it->second;
+    }
+
+    std::runtime_error Resolver::error(std::uint32_t offset, std::string_view message) const {
+        return std::runtime_error(LineTable(source_).format(offset, message));
+    }
+}
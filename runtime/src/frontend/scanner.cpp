@@ -0,0 +1,152 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/frontend/scanner.hpp"
+
+#include <cstring>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#endif
+
+#include "breezy/frontend/char_class.hpp"
+
+#if !defined(BREEZY_NO_SIMD) && (defined(__AVX2__))
+#  define BREEZY_SCANNER_AVX2 1
+#  include <immintrin.h>
+#elif !defined(BREEZY_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define BREEZY_SCANNER_SSE2 1
+#  include <emmintrin.h>
+#endif
+
+namespace breezy::runtime::scanner {
+    namespace {
+        const char* skip_class(const char* it, const char* end, std::uint8_t mask) {
+            while (it < end && has_char_class(*it, mask)) ++it;
+            return it;
+        }
+
+#if defined(BREEZY_SCANNER_AVX2)
+        using Block = __m256i;
+        constexpr int block_size = 32;
+
+        inline Block load(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        inline Block splat(char c) { return _mm256_set1_epi8(c); }
+        inline Block eq(Block a, Block b) { return _mm256_cmpeq_epi8(a, b); }
+        inline Block either(Block a, Block b) { return _mm256_or_si256(a, b); }
+        inline Block sub(Block a, Block b) { return _mm256_sub_epi8(a, b); }
+        inline Block min_u8(Block a, Block b) { return _mm256_min_epu8(a, b); }
+        inline unsigned int bits(Block m) { return static_cast<unsigned int>(_mm256_movemask_epi8(m)); }
+        constexpr unsigned int all_bits = 0xFFFFFFFFu;
+#elif defined(BREEZY_SCANNER_SSE2)
+        using Block = __m128i;
+        constexpr int block_size = 16;
+
+        inline Block load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        inline Block splat(char c) { return _mm_set1_epi8(c); }
+        inline Block eq(Block a, Block b) { return _mm_cmpeq_epi8(a, b); }
+        inline Block either(Block a, Block b) { return _mm_or_si128(a, b); }
+        inline Block sub(Block a, Block b) { return _mm_sub_epi8(a, b); }
+        inline Block min_u8(Block a, Block b) { return _mm_min_epu8(a, b); }
+        inline unsigned int bits(Block m) { return static_cast<unsigned int>(_mm_movemask_epi8(m)); }
+        constexpr unsigned int all_bits = 0xFFFFu;
+#endif
+
+#if defined(BREEZY_SCANNER_AVX2) || defined(BREEZY_SCANNER_SSE2)
+        int count_trailing_zeros(unsigned int bits) {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward(&index, bits);
+            return static_cast<int>(index);
+#else
+            return __builtin_ctz(bits);
+#endif
+        }
+
+        // Lanes where (c - low) <= span, compared unsigned.
+        inline Block in_range(Block c, char low, char span) {
+            Block shifted = sub(c, splat(low));
+            return eq(min_u8(shifted, splat(span)), shifted);
+        }
+
+        inline Block whitespace_mask(Block c) {
+            // ' ' plus the contiguous range '\t'..'\r'
+            return either(eq(c, splat(' ')), in_range(c, '\t', '\r' - '\t'));
+        }
+
+        inline Block digit_mask(Block c) {
+            return in_range(c, '0', 9);
+        }
+
+        inline Block identifier_mask(Block c) {
+            Block lower = either(c, splat(0x20)); // folds 'A'..'Z' onto 'a'..'z'
+            return either(either(in_range(lower, 'a', 25), digit_mask(c)), eq(c, splat('_')));
+        }
+
+        template <typename Mask>
+        const char* skip_blocks(const char* it, const char* end, Mask mask) {
+            while (end - it >= block_size) {
+                unsigned int matched = bits(mask(load(it)));
+                if (matched != all_bits) {
+                    return it + count_trailing_zeros(~matched & all_bits);
+                }
+                it += block_size;
+            }
+            return it;
+        }
+#endif
+    }
+
+    const char* skip_whitespace(const char* begin, const char* end) {
+#if defined(BREEZY_SCANNER_AVX2) || defined(BREEZY_SCANNER_SSE2)
+        begin = skip_blocks(begin, end, whitespace_mask);
+#endif
+        return skip_class(begin, end, CharSpace);
+    }
+
+    const char* skip_identifier(const char* begin, const char* end) {
+#if defined(BREEZY_SCANNER_AVX2) || defined(BREEZY_SCANNER_SSE2)
+        begin = skip_blocks(begin, end, identifier_mask);
+#endif
+        return skip_class(begin, end, CharIdentPart);
+    }
+
+    const char* skip_digits(const char* begin, const char* end) {
+#if defined(BREEZY_SCANNER_AVX2) || defined(BREEZY_SCANNER_SSE2)
+        begin = skip_blocks(begin, end, digit_mask);
+#endif
+        return skip_class(begin, end, CharDigit);
+    }
+
+    const char* find_quote(const char* begin, const char* end) {
+        if (begin >= end) return end;
+        const void* quote = std::memchr(begin, '"', static_cast<std::size_t>(end - begin));
+        return quote ? static_cast<const char*>(quote) : end;
+    }
+}
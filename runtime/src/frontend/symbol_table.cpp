@@ -0,0 +1,104 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/frontend/symbol_table.hpp"
+
+#include <cstring>
+
+namespace breezy::runtime {
+    namespace {
+        constexpr std::size_t initial_slots = 256;
+        constexpr std::size_t storage_block_size = 16 * 1024;
+    }
+
+    SymbolTable::SymbolTable()
+        : slots_(initial_slots, Slot{ 0, no_symbol }) {
+        for (std::string_view keyword : symbols::keywords) intern(keyword);
+    }
+
+    SymbolId SymbolTable::intern(std::string_view name) {
+        std::uint32_t hash = hash_name(name);
+        std::size_t mask = slots_.size() - 1;
+
+        for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+            Slot& slot = slots_[i];
+            if (slot.id == no_symbol) {
+                auto id = static_cast<SymbolId>(names_.size());
+                names_.push_back(store(name));
+                hashes_.push_back(hash);
+                slot = { hash, id };
+
+                // Keep the load factor under one half
+                if (names_.size() * 2 > slots_.size()) grow();
+                return id;
+            }
+            if (slot.hash == hash && names_[slot.id] == name) {
+                return slot.id;
+            }
+        }
+    }
+
+    std::uint32_t SymbolTable::hash_name(std::string_view name) {
+        // FNV-1a
+        std::uint32_t hash = 2166136261u;
+        for (char c : name) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    std::string_view SymbolTable::store(std::string_view name) {
+        if (name.empty()) return {};
+
+        if (block_used_ + name.size() > block_size_) {
+            block_size_ = name.size() > storage_block_size ? name.size() : storage_block_size;
+            blocks_.push_back(std::make_unique<char[]>(block_size_));
+            block_used_ = 0;
+        }
+
+        char* dest = blocks_.back().get() + block_used_;
+        std::memcpy(dest, name.data(), name.size());
+        block_used_ += name.size();
+        return { dest, name.size() };
+    }
+
+    void SymbolTable::grow() {
+        std::vector<Slot> slots(slots_.size() * 2, Slot{ 0, no_symbol });
+        std::size_t mask = slots.size() - 1;
+
+        for (const Slot& slot : slots_) {
+            if (slot.id == no_symbol) continue;
+            std::size_t i = slot.hash & mask;
+            while (slots[i].id != no_symbol) i = (i + 1) & mask;
+            slots[i] = slot;
+        }
+        slots_.swap(slots);
+    }
+}
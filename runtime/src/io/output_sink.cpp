@@ -0,0 +1,122 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/io/output_sink.hpp"
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace breezy::runtime {
+    namespace {
+        // Longest shortest-round-trip double ("-2.2250738585072014e-308") plus slack
+        constexpr std::size_t max_number_length = 32;
+    }
+
+    OutputSink::OutputSink()
+        : buffer_(new char[capacity]) {}
+
+    OutputSink::~OutputSink() {
+        flush();
+    }
+
+    void OutputSink::set_writer(OutputWriter writer, void* user_data) {
+        flush();
+        writer_ = writer;
+        user_data_ = user_data;
+    }
+
+    void OutputSink::write(std::string_view text) {
+        if (text.size() > capacity - used_) {
+            flush();
+            if (text.size() >= capacity) {
+                emit(OutputStream::Out, text.data(), text.size());
+                return;
+            }
+        }
+        std::memcpy(buffer_.get() + used_, text.data(), text.size());
+        used_ += text.size();
+    }
+
+    void OutputSink::write(char c) {
+        *reserve(1) = c;
+        ++used_;
+    }
+
+    void OutputSink::write_number(double value) {
+        char* first = reserve(max_number_length);
+        auto [last, ec] = std::to_chars(first, first + max_number_length, value);
+        used_ += static_cast<std::size_t>(last - first);
+    }
+
+    void OutputSink::write_integer(std::int64_t value) {
+        char* first = reserve(max_number_length);
+        auto [last, ec] = std::to_chars(first, first + max_number_length, value);
+        used_ += static_cast<std::size_t>(last - first);
+    }
+
+    void OutputSink::write_value(Value value) {
+        if (value.is_double())    write_number(value.as_double());
+        else if (value.is_int())  write_integer(value.as_int());
+        else if (value.is_bool()) write(value.as_bool() ? std::string_view("true") : std::string_view("false"));
+        else if (value.is_nil())  write(std::string_view("nil"));
+        else                      write(value.as_string()->view());
+    }
+
+    void OutputSink::error(std::string_view text) {
+        flush();
+        std::string line(text);
+        line += '\n';
+        emit(OutputStream::Err, line.data(), line.size());
+    }
+
+    void OutputSink::flush() {
+        if (used_ == 0) return;
+        std::size_t size = used_;
+        used_ = 0;
+        emit(OutputStream::Out, buffer_.get(), size);
+    }
+
+    void OutputSink::emit(OutputStream stream, const char* data, std::size_t size) {
+        if (writer_) {
+            writer_(stream, data, size, user_data_);
+            return;
+        }
+
+        std::FILE* file = stream == OutputStream::Err ? stderr : stdout;
+        std::fwrite(data, 1, size, file);
+        std::fflush(file);
+    }
+
+    char* OutputSink::reserve(std::size_t size) {
+        if (capacity - used_ < size) flush();
+        return buffer_.get() + used_;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/memory/arena.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace breezy::runtime {
+    namespace {
+        constexpr std::size_t header_size = (sizeof(void*) * 2 + alignof(std::max_align_t) - 1)
+                                          & ~(alignof(std::max_align_t) - 1);
+
+        std::uintptr_t align_up(std::uintptr_t value, std::size_t alignment) {
+            return (value + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        }
+    }
+
+    Arena::Arena(std::size_t block_size)
+        : block_size_(block_size) {}
+
+    Arena::~Arena() {
+        Block* block = head_;
+        while (block) {
+            Block* next = block->next;
+            std::free(block);
+            block = next;
+        }
+    }
+
+    void* Arena::allocate(std::size_t size, std::size_t alignment) {
+        auto start = align_up(reinterpret_cast<std::uintptr_t>(cursor_), alignment);
+        if (!cursor_ || start + size > reinterpret_cast<std::uintptr_t>(limit_)) {
+            add_block(size + alignment);
+            start = align_up(reinterpret_cast<std::uintptr_t>(cursor_), alignment);
+        }
+
+        char* result = reinterpret_cast<char*>(start);
+        used_ += (result + size) - cursor_;
+        cursor_ = result + size;
+        if (used_ > peak_) peak_ = used_;
+        return result;
+    }
+
+    void Arena::reset() {
+        if (!head_) return;
+
+        // Blocks are pushed at the front, so the oldest (first) block is the tail.
+        Block* block = head_;
+        while (block->next) {
+            Block* next = block->next;
+            capacity_ -= block->size;
+            std::free(block);
+            block = next;
+        }
+
+        head_ = block;
+        cursor_ = reinterpret_cast<char*>(block) + header_size;
+        limit_ = reinterpret_cast<char*>(block) + block->size;
+        used_ = 0;
+    }
+
+    void Arena::add_block(std::size_t min_size) {
+        std::size_t size = header_size + (min_size > block_size_ ? min_size : block_size_);
+
+        auto* block = static_cast<Block*>(std::malloc(size));
+        if (!block) throw std::bad_alloc();
+
+        block->next = head_;
+        block->size = size;
+        head_ = block;
+        capacity_ += size;
+
+        cursor_ = reinterpret_cast<char*>(block) + header_size;
+        limit_ = reinterpret_cast<char*>(block) + size;
+    }
+}
@@ -0,0 +1,98 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/memory/heap.hpp"
+
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+#include "breezy/frontend/symbol_table.hpp"
+
+namespace breezy::runtime {
+    Heap::~Heap() {
+        reset();
+    }
+
+    void Heap::reset() {
+        while (objects_) {
+            Object* next = objects_->next;
+            ::operator delete(objects_);
+            objects_ = next;
+        }
+        interned_.clear();
+        object_count_ = 0;
+        bytes_ = 0;
+    }
+
+    const StringObject* Heap::intern(std::string_view text) {
+        auto it = interned_.find(text);
+        if (it != interned_.end()) return it->second;
+
+        StringObject* string = allocate_string(text.size());
+        std::memcpy(const_cast<char*>(string->chars()), text.data(), text.size());
+        const StringObject* result = finish(string);
+
+        interned_.emplace(result->view(), result);
+        return result;
+    }
+
+    const StringObject* Heap::concat(const StringObject* left, const StringObject* right) {
+        StringObject* string = allocate_string(static_cast<std::size_t>(left->length) + right->length);
+        char* chars = const_cast<char*>(string->chars());
+        std::memcpy(chars, left->chars(), left->length);
+        std::memcpy(chars + left->length, right->chars(), right->length);
+        return finish(string);
+    }
+
+    StringObject* Heap::allocate_string(std::size_t length) {
+        if (length > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::runtime_error("String too long.");
+        }
+
+        std::size_t size = sizeof(StringObject) + length + 1;
+        auto* string = new (::operator new(size)) StringObject();
+        string->type = ObjectType::String;
+        string->next = objects_;
+        string->length = static_cast<std::uint32_t>(length);
+        string->hash = 0;
+        const_cast<char*>(string->chars())[length] = '\0';
+
+        objects_ = string;
+        ++object_count_;
+        bytes_ += size;
+        return string;
+    }
+
+    const StringObject* Heap::finish(StringObject* string) {
+        string->hash = SymbolTable::hash_name(string->view());
+        return string;
+    }
+}
@@ -31,19 +31,106 @@
 
 #include <filesystem>
 #include <fstream>
-#include <iostream>
-#include <ostream>
-#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
 #include <vector>
 
 #include "breezy/frontend/interpreter.hpp"
 #include "breezy/frontend/lexer.hpp"
 #include "breezy/frontend/parser.hpp"
+#include "breezy/frontend/resolver.hpp"
+#include "breezy/io/mapped_file.hpp"
+#include "breezy/vm/compiler.hpp"
+#include "breezy/vm/vm.hpp"
 
 namespace breezy::runtime {
-    RuntimeInstance::RuntimeInstance() {
+    namespace {
+        // For files that cannot be mapped: one read into a buffer of the file's size
+        bool read_file(const std::filesystem::path& path, std::string& out) {
+            std::ifstream file(path, std::ios::in | std::ios::binary);
+            std::error_code error;
+            auto size = std::filesystem::file_size(path, error);
+            if (!file || error) {
+                return false;
+            }
+
+            out.resize(static_cast<std::size_t>(size));
+            file.read(out.data(), static_cast<std::streamsize>(out.size()));
+            out.resize(static_cast<std::size_t>(file.gcount()));
+            return !file.bad();
+        }
+
+        // Brackets a run_file() / run_string() for the profiler and the trace, if
+        // either is on; `source` is set once the script is loaded.
+        class RunScope {
+        public:
+            RunScope(SamplingProfiler* profiler, TraceBuffer* trace, const NativeRegistry& natives, std::string_view script)
+                : profiler_(profiler), trace_(trace), natives_(natives) {
+                if (trace_) trace_->begin_run();
+                if (profiler_) profiler_->begin_run(script);
+            }
+
+            ~RunScope() {
+                if (profiler_) profiler_->end_run(natives_, source);
+                if (trace_) trace_->end_run(source);
+            }
+
+            std::string_view source;
+
+        private:
+            SamplingProfiler* profiler_;
+            TraceBuffer* trace_;
+            const NativeRegistry& natives_;
+        };
+
+        // Runs a chunk the way the Interpreter runs a unit: a runtime error is reported
+        // and execution goes on with the next top-level statement. Returns false if any
+        // statement failed.
+        bool run_statements(VirtualMachine& vm, const Chunk& chunk, const std::vector<std::uint32_t>& links,
+                            OutputSink& output) {
+            bool ok = true;
+            std::uint32_t pc = 0;
+            for (;;) {
+                try {
+                    vm.run(chunk, links, pc);
+                    return ok;
+                }
+                catch (const std::runtime_error& e) {
+                    output.error(std::string("Runtime error: ") + e.what());
+                    ok = false;
+                    pc = next_statement_pc(chunk, vm.failed_pc());
+                }
+            }
+        }
+
+        // Adds the objects a run allocates on `heap` to the allocation counters
+        class HeapUsage {
+        public:
+#ifdef BREEZY_STATS
+            HeapUsage(const Heap& heap, RuntimeStats& stats)
+                : heap_(heap), stats_(stats), objects_(heap.object_count()), bytes_(heap.bytes()) {}
+
+            ~HeapUsage() {
+                stats_.allocations += heap_.object_count() - objects_;
+                stats_.allocated_bytes += heap_.bytes() - bytes_;
+            }
+
+        private:
+            const Heap& heap_;
+            RuntimeStats& stats_;
+            std::size_t objects_;
+            std::size_t bytes_;
+#else
+            HeapUsage(const Heap&, RuntimeStats&) {}
+#endif
+        };
+    }
+
+    RuntimeInstance::RuntimeInstance()
+        : natives_(symbols_), optimizer_(natives_, output_), resolver_(symbols_, natives_) {
         // TODO: Initialize future components
     }
 
@@ -51,59 +138,316 @@ namespace breezy::runtime {
         // TODO: Cleanup future components
     }
 
-    void RuntimeInstance::run_file(const std::string& filepath) {
+    bool RuntimeInstance::run_file(const std::string& filepath) {
         std::filesystem::path path(filepath);
 
+        // Lex straight out of the page cache. Tokens and the AST point into the source,
+        // so the mapping (or the fallback buffer) outlives the whole run, the profiler
+        // and trace included; a compiled Program copies what it keeps and does not
+        // need it afterwards.
+        MappedFile mapping;
+        std::string buffer;
+        std::string_view source;
+        RunScope scope(profiler_.get(), trace_.get(), natives_, path.string());
+
         if (!std::filesystem::exists(path)) {
-            std::cerr << "File does not exist: " << path << std::endl;
-            return;
+            output_.error("File does not exist: \"" + path.string() + "\"");
+            return false;
         }
 
         if (!std::filesystem::is_regular_file(path)) {
-            std::cerr << "Not a regular file: " << path << std::endl;
-            return;
+            output_.error("Not a regular file: \"" + path.string() + "\"");
+            return false;
+        }
+
+        {
+            TraceSpan span(trace_.get(), "load");
+            if (mapping.open(path)) {
+                mapping.advise_sequential();
+                source = mapping.view();
+            }
+            else if (read_file(path, buffer)) {
+                source = buffer;
+            }
+            else {
+                output_.error("Failed to open file: \"" + path.string() + "\"");
+                return false;
+            }
+        }
+
+        scope.source = source;
+        if (cache_ && engine_ == Engine::Bytecode && optimization_level_ > 0) {
+            return execute_cached(source);
         }
+        bool ok = execute(source);
+        output_.flush();
+        return ok;
+    }
 
-        std::ifstream file(path, std::ios::in);
-        if (!file) {
-            std::cerr << "Failed to open file: " << path << std::endl;
+    void RuntimeInstance::enable_profiling(unsigned samples_per_second) {
+        profiler_ = std::make_unique<SamplingProfiler>(samples_per_second);
+    }
+
+    void RuntimeInstance::enable_cache(const std::filesystem::path& directory) {
+        std::filesystem::path location = directory.empty() ? ProgramCache::default_directory() : directory;
+        if (location.empty()) {
+            cache_.reset();
             return;
         }
+        cache_.emplace(std::move(location));
+    }
 
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        execute(buffer.str());
+    void RuntimeInstance::register_native(const std::string& name, HostFunction function, int arity, void* user_data) {
+        natives_.define_host(name, function, arity, user_data);
+        linked_program_ = 0;    // the new definition may change an import's arity
     }
 
-    void RuntimeInstance::run_string(const std::string& code) {
-        execute(code);
+    bool RuntimeInstance::run_string(const std::string& code) {
+        RunScope scope(profiler_.get(), trace_.get(), natives_, "<string>");
+        scope.source = code;
+        bool ok = execute(code);
+        output_.flush();
+        return ok;
     }
 
-    void RuntimeInstance::execute(const std::string& code) {
-        // Tokenize
-        Lexer lexer(code);
-        auto tokens = lexer.tokenize();
+    void RuntimeInstance::reset() {
+        resolver_.reset();
+        slots_.clear();
+        unit_.arena.reset();
+        unit_.statements.clear();
+        heap_.reset();
+        linked_program_ = 0;
+    }
 
-        // Parse
-        Parser parser(tokens);
-        std::vector<Stmt> program;
-        try {
-            program = parser.parse();
+    void RuntimeInstance::set_output(OutputWriter writer, void* user_data) {
+        output_.set_writer(writer, user_data);
+    }
+
+    bool RuntimeInstance::execute(std::string_view code) {
+        // Only the previous snippet's tree is dropped; the session state is kept
+        unit_.arena.reset();
+        unit_.statements.clear();
+
+        if (!parse(code, unit_)) {
+            return false;
         }
-        catch (const std::runtime_error& e) {
-            std::cerr << "Parser error: " << e.what() << std::endl;
-            return;
+
+        // Bind every variable reference to a scope slot
+        if (!resolve(resolver_, unit_, code)) {
+            return false;
+        }
+
+        // Later snippets may read any global, so stores to them all stay
+        optimize(unit_, resolver_.global_count(), true);
+
+        if (engine_ == Engine::Bytecode) {
+            Chunk chunk;
+            try {
+                PhaseTimer timer(stats_.compile_seconds);
+                TraceSpan span(trace_.get(), "compile");
+                enter_phase(ProfilePhase::Compile);
+                chunk = Compiler(heap_, natives_).compile(unit_, resolver_.global_count());
+            }
+            catch (const std::runtime_error& e) {
+                output_.error(std::string("Compile error: ") + e.what());
+                return false;
+            }
+
+            // Compiled against this registry, so every import is already linked
+            session_links_.clear();
+            for (const NativeImport& import : chunk.imports) {
+                session_links_.push_back(import.native);
+            }
+
+            bool ok;
+            HeapUsage usage(heap_, stats_);
+            {
+                PhaseTimer timer(stats_.execute_seconds);
+                TraceSpan span(trace_.get(), "execute");
+                VirtualMachine vm(heap_, natives_, output_, slots_, stats_);
+                vm.set_trace(trace_.get());
+                if (profiler_) {
+                    vm.set_probe(&profiler_->probe());
+                    profiler_->attach(&chunk);
+                }
+                ok = run_statements(vm, chunk, session_links_, output_);
+            }
+            if (profiler_) profiler_->detach();
+            return ok;
         }
 
         // Interpret
-        Interpreter interpreter;
-        for (auto& stmt : program) {
+        bool ok = true;
+        HeapUsage usage(heap_, stats_);
+        PhaseTimer timer(stats_.execute_seconds);
+        TraceSpan span(trace_.get(), "execute");
+        Interpreter interpreter(heap_, natives_, output_, slots_, stats_);
+        interpreter.ensure_globals(resolver_.global_count());
+        interpreter.set_trace(trace_.get());
+        if (profiler_) {
+            interpreter.set_probe(&profiler_->probe());
+            profiler_->attach(nullptr);
+        }
+        for (auto& stmt : unit_.statements) {
+            TraceSpan statement(trace_.get(), "statement", "statement", statement_offset(stmt));
             try {
                 interpreter.execute(stmt);
             }
             catch (const std::runtime_error& e) {
-                std::cerr << "Runtime error: " << e.what() << std::endl;
+                output_.error(std::string("Runtime error: ") + e.what());
+                ok = false;
+            }
+        }
+        if (profiler_) profiler_->detach();
+        return ok;
+    }
+
+    std::unique_ptr<Program> RuntimeInstance::compile(std::string_view code) {
+        CompilationUnit unit;
+        if (!parse(code, unit)) {
+            return nullptr;
+        }
+
+        // A fresh global scope: the program must not see, or claim slots in, the session's
+        Resolver resolver(symbols_, natives_);
+        if (!resolve(resolver, unit, code)) {
+            return nullptr;
+        }
+        optimize(unit, resolver.global_count(), false);  // the program's globals die with each run
+
+        auto program = std::make_unique<Program>();
+        try {
+            PhaseTimer timer(stats_.compile_seconds);
+            TraceSpan span(trace_.get(), "compile");
+            enter_phase(ProfilePhase::Compile);
+            program->chunk = Compiler(program->heap, natives_).compile(unit, resolver.global_count());
+        }
+        catch (const std::runtime_error& e) {
+            output_.error(std::string("Compile error: ") + e.what());
+            return nullptr;
+        }
+        return program;
+    }
+
+    bool RuntimeInstance::execute(const Program& program) {
+        // Hot programs are executed back to back, so only a change of program (or of
+        // the natives) relinks
+        if (linked_program_ != program.id) {
+            linked_program_ = 0;
+            try {
+                link(program.chunk, program_links_);
+            }
+            catch (const std::runtime_error& e) {
+                output_.error(std::string("Link error: ") + e.what());
+                return false;
+            }
+            linked_program_ = program.id;
+        }
+
+        // Fresh globals: the previous run's values point into program_heap_, which it
+        // reset on the way out
+        program_registers_.assign(program.chunk.register_count, Value::nil());
+
+        bool ok;
+        {
+            HeapUsage usage(program_heap_, stats_);
+            {
+                PhaseTimer timer(stats_.execute_seconds);
+                TraceSpan span(trace_.get(), "execute");
+                VirtualMachine vm(program_heap_, natives_, output_, program_registers_, stats_);
+                vm.set_trace(trace_.get());
+                if (profiler_) {
+                    vm.set_probe(&profiler_->probe());
+                    profiler_->attach(&program.chunk);
+                }
+                ok = run_statements(vm, program.chunk, program_links_, output_);
+            }
+            if (profiler_) profiler_->detach();
+        }
+
+        output_.flush();
+        program_heap_.reset();
+        return ok;
+    }
+
+    bool RuntimeInstance::execute_cached(std::string_view code) {
+        const std::uint64_t natives = natives_.fingerprint();
+        std::unique_ptr<Program> program;
+        {
+            PhaseTimer timer(stats_.load_seconds);
+            TraceSpan span(trace_.get(), "cache load");
+            enter_phase(ProfilePhase::Load);
+            program = cache_->load(code, natives);
+        }
+        if (!program) {
+            program = compile(code);
+            if (!program) {
+                output_.flush();
+                return false;
+            }
+            PhaseTimer timer(stats_.load_seconds);
+            TraceSpan span(trace_.get(), "cache store");
+            enter_phase(ProfilePhase::Load);
+            cache_->store(*program, code, natives);
+        }
+        return execute(*program);
+    }
+
+    bool RuntimeInstance::parse(std::string_view code, CompilationUnit& unit) {
+        // Tokenize & Parse in a single streaming pass
+        PhaseTimer timer(stats_.parse_seconds);
+        TraceSpan span(trace_.get(), "parse");
+        enter_phase(ProfilePhase::Parse);
+        try {
+            Lexer lexer(code, symbols_);
+            Parser parser(lexer, unit.arena);
+            unit.statements = parser.parse();
+
+            BREEZY_STAT(stats_.bytes_lexed += code.size());
+            BREEZY_STAT(stats_.tokens_lexed += lexer.token_count());
+            BREEZY_STAT(stats_.ast_nodes += parser.node_count());
+        }
+        catch (const std::runtime_error& e) {
+            output_.error(std::string("Parser error: ") + e.what());
+            return false;
+        }
+        return true;
+    }
+
+    bool RuntimeInstance::resolve(Resolver& resolver, CompilationUnit& unit, std::string_view code) {
+        PhaseTimer timer(stats_.resolve_seconds);
+        TraceSpan span(trace_.get(), "resolve");
+        enter_phase(ProfilePhase::Resolve);
+        try {
+            resolver.resolve(unit, code);
+        }
+        catch (const std::runtime_error& e) {
+            output_.error(std::string("Resolver error: ") + e.what());
+            return false;
+        }
+        return true;
+    }
+
+    void RuntimeInstance::optimize(CompilationUnit& unit, std::uint32_t global_count, bool globals_escape) {
+        if (optimization_level_ == 0) return;
+
+        PhaseTimer timer(stats_.optimize_seconds);
+        TraceSpan span(trace_.get(), "optimize");
+        enter_phase(ProfilePhase::Optimize);
+        optimizer_.optimize(unit, global_count, globals_escape);
+    }
+
+    void RuntimeInstance::link(const Chunk& chunk, std::vector<std::uint32_t>& links) {
+        links.clear();
+        for (const NativeImport& import : chunk.imports) {
+            std::uint32_t index = natives_.find(symbols_.intern(import.name));
+            if (index == NativeRegistry::npos) {
+                throw std::runtime_error("Undefined function '" + import.name + "'.");
+            }
+            if (natives_[index].arity != import.arity) {
+                throw std::runtime_error("'" + import.name + "' was redefined with a different arity.");
             }
+            links.push_back(index);
         }
     }
 }
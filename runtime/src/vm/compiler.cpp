@@ -0,0 +1,272 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/vm/compiler.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+#include "breezy/frontend/operators.hpp"
+
+namespace breezy::runtime {
+    namespace {
+        OpCode binary_opcode(BinaryOp op) {
+            switch (op) {
+                case BinaryOp::Add:          return OpCode::Add;
+                case BinaryOp::Subtract:     return OpCode::Subtract;
+                case BinaryOp::Multiply:     return OpCode::Multiply;
+                case BinaryOp::Divide:       return OpCode::Divide;
+                case BinaryOp::Modulo:       return OpCode::Modulo;
+                case BinaryOp::Less:         return OpCode::Less;
+                case BinaryOp::LessEqual:    return OpCode::LessEqual;
+                case BinaryOp::Greater:      return OpCode::Greater;
+                case BinaryOp::GreaterEqual: return OpCode::GreaterEqual;
+                case BinaryOp::Equal:        return OpCode::Equal;
+                case BinaryOp::NotEqual:     return OpCode::NotEqual;
+                default:                     break; // And / Or short-circuit
+            }
+            return OpCode::Halt;
+        }
+    }
+
+    Compiler::Compiler(Heap& heap, const NativeRegistry& natives)
+        : heap_(heap), natives_(natives) {}
+
+    Chunk Compiler::compile(const CompilationUnit& unit, std::uint32_t global_count) {
+        chunk_ = Chunk{};
+        constant_indices_.clear();
+        import_indices_.clear();
+        scope_bases_.assign(1, 0);
+        reserve_registers(global_count);
+        locals_top_ = top_ = global_count;
+
+        for (const Stmt& stmt : unit.statements) {
+            chunk_.statements.push_back({ static_cast<std::uint32_t>(chunk_.code.size()), statement_offset(stmt) });
+            statement(stmt);
+        }
+        emit(OpCode::Halt);
+
+        return std::move(chunk_);
+    }
+
+    void Compiler::statement(const Stmt& stmt) {
+        std::visit([this](auto&& node) {
+            using T = std::decay_t<decltype(node)>;
+
+            if constexpr (!std::is_same_v<T, BlockStmt>) {
+                mark_position(node.offset);
+            }
+
+            if constexpr (std::is_same_v<T, VarDeclStmt>) {
+                Reg dest = static_cast<Reg>(scope_bases_.back() + node.slot);
+                if (node.initializer) {
+                    expression(*node.initializer, dest);
+                }
+                else {
+                    emit(OpCode::LoadNil, dest);
+                }
+            }
+            else if constexpr (std::is_same_v<T, ExprStmt>) {
+                if (auto* call_expr = std::get_if<CallExpr>(&node.expression)) {
+                    call(*call_expr); // the result is unused; skip materializing it
+                }
+                else {
+                    operand(node.expression);
+                }
+                top_ = locals_top_;
+            }
+            else {
+                block(node);
+            }
+        }, stmt);
+    }
+
+    void Compiler::block(const BlockStmt& stmt) {
+        std::uint32_t outer_top = locals_top_;
+        scope_bases_.push_back(locals_top_);
+        locals_top_ += stmt.slot_count;
+        reserve_registers(locals_top_);
+        top_ = locals_top_;
+
+        for (const Stmt& child : stmt.statements) {
+            statement(child);
+        }
+
+        scope_bases_.pop_back();
+        locals_top_ = top_ = outer_top;
+    }
+
+    void Compiler::expression(const Expr& expr, Reg dest) {
+        std::uint32_t mark = top_;
+
+        std::visit([&](auto&& node) {
+            using T = std::decay_t<decltype(node)>;
+
+            if constexpr (std::is_same_v<T, LiteralExpr>) {
+                Value value = literal_value(node, heap_);
+                if (value.is_nil()) {
+                    emit(OpCode::LoadNil, dest);
+                }
+                else {
+                    emit_bx(OpCode::LoadK, dest, constant(value));
+                }
+            }
+            else if constexpr (std::is_same_v<T, VariableExpr>) {
+                Reg source = variable(node);
+                if (source != dest) emit(OpCode::Move, dest, source);
+            }
+            else if constexpr (std::is_same_v<T, CallExpr>) {
+                Reg result = call(node);
+                emit(OpCode::Move, dest, result);
+            }
+            else if constexpr (std::is_same_v<T, UnaryExpr>) {
+                Reg source = operand(*node.operand);
+                emit(node.op == UnaryOp::Negate ? OpCode::Negate : OpCode::Not, dest, source);
+            }
+            else {
+                if (node.op == BinaryOp::And || node.op == BinaryOp::Or) {
+                    logical(node, dest);
+                    return;
+                }
+                Reg left = operand(*node.left);
+                Reg right = operand(*node.right);
+                emit(binary_opcode(node.op), dest, left, right);
+            }
+        }, expr);
+
+        top_ = mark;
+    }
+
+    Compiler::Reg Compiler::operand(const Expr& expr) {
+        if (auto* var = std::get_if<VariableExpr>(&expr)) {
+            return variable(*var);
+        }
+        Reg temp = allocate();
+        expression(expr, temp);
+        return temp;
+    }
+
+    void Compiler::logical(const BinaryExpr& expr, Reg dest) {
+        // A variable destination may also be read by the right operand, so build
+        // the result in a temporary and copy it over at the end.
+        bool needs_temp = dest < locals_top_;
+        Reg result = needs_temp ? allocate() : dest;
+
+        emit(OpCode::Bool, result, operand(*expr.left));
+        std::size_t skip = emit_bx(expr.op == BinaryOp::And ? OpCode::JumpIfFalse : OpCode::JumpIfTrue, result, 0);
+        emit(OpCode::Bool, result, operand(*expr.right));
+        patch_jump(skip);
+
+        if (needs_temp) emit(OpCode::Move, dest, result);
+    }
+
+    Compiler::Reg Compiler::call(const CallExpr& expr) {
+        if (expr.arguments.size > 0xFFFFu) {
+            throw std::runtime_error("Call has too many arguments.");
+        }
+        std::uint32_t target = import(expr.native);
+
+        // Arguments go to consecutive registers; the result replaces the first.
+        Reg base = allocate();
+        for (std::uint32_t i = 0; i < expr.arguments.size; ++i) {
+            Reg slot = i == 0 ? base : allocate();
+            expression(expr.arguments[i], slot);
+        }
+
+        emit(OpCode::CallNative, base, target, expr.arguments.size);
+        return base;
+    }
+
+    Compiler::Reg Compiler::variable(const VariableExpr& expr) const {
+        return static_cast<Reg>(scope_bases_[scope_bases_.size() - 1 - expr.depth] + expr.slot);
+    }
+
+    Compiler::Reg Compiler::allocate() {
+        reserve_registers(top_ + 1);
+        return static_cast<Reg>(top_++);
+    }
+
+    void Compiler::reserve_registers(std::uint32_t end) {
+        if (end > max_registers) {
+            throw std::runtime_error("Program needs more than 65536 registers.");
+        }
+        if (end > chunk_.register_count) chunk_.register_count = end;
+    }
+
+    std::uint32_t Compiler::constant(Value value) {
+        // Keyed on the bit pattern: 0.0 and -0.0 stay distinct, and interned strings
+        // share one entry.
+        auto [it, inserted] = constant_indices_.try_emplace(value.bits(), static_cast<std::uint32_t>(chunk_.constants.size()));
+        if (inserted) chunk_.constants.push_back(value);
+        return it->second;
+    }
+
+    std::uint32_t Compiler::import(std::uint32_t native) {
+        auto [it, inserted] = import_indices_.try_emplace(native, static_cast<std::uint32_t>(chunk_.imports.size()));
+        if (inserted) {
+            if (chunk_.imports.size() > 0xFFFFu) {
+                throw std::runtime_error("Program calls more than 65536 distinct natives.");
+            }
+            const Native& target = natives_[native];
+            chunk_.imports.push_back({ std::string(target.name), target.arity, native });
+        }
+        return it->second;
+    }
+
+    std::size_t Compiler::emit(OpCode op, std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+        Instruction instruction{ op };
+        instruction.a = static_cast<std::uint16_t>(a);
+        instruction.b = static_cast<std::uint16_t>(b);
+        instruction.c = static_cast<std::uint16_t>(c);
+        chunk_.code.push_back(instruction);
+        return chunk_.code.size() - 1;
+    }
+
+    std::size_t Compiler::emit_bx(OpCode op, std::uint32_t a, std::uint32_t bx) {
+        return emit(op, a, bx & 0xFFFFu, bx >> 16);
+    }
+
+    void Compiler::patch_jump(std::size_t at) {
+        auto target = static_cast<std::uint32_t>(chunk_.code.size());
+        chunk_.code[at].b = static_cast<std::uint16_t>(target & 0xFFFFu);
+        chunk_.code[at].c = static_cast<std::uint16_t>(target >> 16);
+    }
+
+    void Compiler::mark_position(std::uint32_t offset) {
+        auto pc = static_cast<std::uint32_t>(chunk_.code.size());
+        // A statement that emitted nothing is superseded by the next one
+        if (!chunk_.positions.empty() && chunk_.positions.back().pc == pc) {
+            chunk_.positions.back().offset = offset;
+            return;
+        }
+        chunk_.positions.push_back({ pc, offset });
+    }
+}
@@ -0,0 +1,188 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/vm/natives.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace breezy::runtime {
+    namespace {
+        double number_argument(const NativeCall& call, const Value* args, std::uint32_t index) {
+            if (!args[index].is_number()) {
+                throw std::runtime_error("Argument " + std::to_string(index + 1) + " to '"
+                    + std::string(call.native.name) + "' must be a number, got " + type_name(args[index]) + ".");
+            }
+            return args[index].to_double();
+        }
+
+        // Integral results of integral inputs stay integers
+        Value number_result(double value) {
+            if (value >= INT32_MIN && value <= INT32_MAX && value == static_cast<std::int32_t>(value)
+                && !(value == 0 && std::signbit(value))) {
+                return Value::integer(static_cast<std::int32_t>(value));
+            }
+            return Value::number(value);
+        }
+
+        Value native_print(NativeCall& call, const Value* args, std::uint32_t count) {
+            for (std::uint32_t i = 0; i < count; ++i) {
+                call.out.write_value(args[i]);
+                call.out.write(' ');
+            }
+            call.out.write('\n');
+            return Value::nil();
+        }
+
+        Value native_abs(NativeCall& call, const Value* args, std::uint32_t) {
+            if (args[0].is_int()) return Value::from_int64(std::abs(static_cast<std::int64_t>(args[0].as_int())));
+            return Value::number(std::fabs(number_argument(call, args, 0)));
+        }
+
+        Value native_sqrt(NativeCall& call, const Value* args, std::uint32_t) {
+            return Value::number(std::sqrt(number_argument(call, args, 0)));
+        }
+
+        Value native_floor(NativeCall& call, const Value* args, std::uint32_t) {
+            if (args[0].is_int()) return args[0];
+            return number_result(std::floor(number_argument(call, args, 0)));
+        }
+
+        Value native_ceil(NativeCall& call, const Value* args, std::uint32_t) {
+            if (args[0].is_int()) return args[0];
+            return number_result(std::ceil(number_argument(call, args, 0)));
+        }
+
+        template <bool Max>
+        Value native_extreme(NativeCall& call, const Value* args, std::uint32_t count) {
+            if (count == 0) {
+                throw std::runtime_error("'" + std::string(call.native.name) + "' expects at least one argument.");
+            }
+            std::uint32_t best = 0;
+            double best_value = number_argument(call, args, 0);
+            for (std::uint32_t i = 1; i < count; ++i) {
+                double value = number_argument(call, args, i);
+                if (Max ? value > best_value : value < best_value) {
+                    best = i;
+                    best_value = value;
+                }
+            }
+            return args[best];
+        }
+
+        Value native_len(NativeCall&, const Value* args, std::uint32_t) {
+            if (!args[0].is_string()) {
+                throw std::runtime_error(std::string("'len' expects a string, got ") + type_name(args[0]) + ".");
+            }
+            return Value::from_int64(args[0].as_string()->length);
+        }
+
+        // Bridges a HostFunction: unboxes the arguments, boxes the result.
+        Value call_host(NativeCall& call, const Value* args, std::uint32_t count) {
+            constexpr std::uint32_t inline_args = 16;
+            double inline_buffer[inline_args];
+            std::vector<double> heap_buffer;
+            double* numbers = inline_buffer;
+            if (count > inline_args) {
+                heap_buffer.resize(count);
+                numbers = heap_buffer.data();
+            }
+
+            for (std::uint32_t i = 0; i < count; ++i) {
+                numbers[i] = number_argument(call, args, i);
+            }
+            return Value::number(call.native.host(numbers, static_cast<int>(count), call.native.user_data));
+        }
+    }
+
+    NativeRegistry::NativeRegistry(SymbolTable& symbols)
+        : symbols_(symbols) {
+        define("print", native_print, variadic);
+        define("abs", native_abs, 1, true);
+        define("sqrt", native_sqrt, 1, true);
+        define("floor", native_floor, 1, true);
+        define("ceil", native_ceil, 1, true);
+        define("min", native_extreme<false>, variadic, true);
+        define("max", native_extreme<true>, variadic, true);
+        define("len", native_len, 1, true);
+    }
+
+    std::uint64_t NativeRegistry::fingerprint() const {
+        // 64-bit FNV-1a over (name, arity, flags) of each native, in index order
+        std::uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](const void* data, std::size_t size) {
+            for (std::size_t i = 0; i < size; ++i) {
+                hash ^= static_cast<const unsigned char*>(data)[i];
+                hash *= 1099511628211ull;
+            }
+        };
+
+        for (const Native& native : natives_) {
+            std::uint32_t length = static_cast<std::uint32_t>(native.name.size());
+            std::int32_t arity = native.arity;
+            std::uint8_t flags = (native.pure ? 1 : 0) | (native.host ? 2 : 0);
+            mix(&length, sizeof(length));
+            mix(native.name.data(), native.name.size());
+            mix(&arity, sizeof(arity));
+            mix(&flags, sizeof(flags));
+        }
+        return hash;
+    }
+
+    std::uint32_t NativeRegistry::define(std::string_view name, NativeFunction function, int arity, bool pure) {
+        return define(Native{ name, function, arity, nullptr, nullptr, pure });
+    }
+
+    std::uint32_t NativeRegistry::define_host(std::string_view name, HostFunction function, int arity, void* user_data) {
+        return define(Native{ name, call_host, arity, function, user_data });
+    }
+
+    std::uint32_t NativeRegistry::define(const Native& native) {
+        SymbolId symbol = symbols_.intern(native.name);
+
+        Native entry = native;
+        entry.name = symbols_.name(symbol);
+
+        auto [it, inserted] = indices_.try_emplace(symbol, static_cast<std::uint32_t>(natives_.size()));
+        if (inserted) {
+            natives_.push_back(entry);
+        }
+        else {
+            natives_[it->second] = entry;
+        }
+        return it->second;
+    }
+
+    std::uint32_t NativeRegistry::find(SymbolId name) const {
+        auto it = indices_.find(name);
+        return it == indices_.end() ? npos : it->second;
+    }
+}
@@ -0,0 +1,389 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/vm/program_cache.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "breezy/io/mapped_file.hpp"
+#include "breezy/vm/compiler.hpp"
+#include "breezy/vm/natives.hpp"
+
+namespace breezy::runtime {
+    namespace {
+        constexpr char magic[4] = { 'B', 'Z', 'B', 'C' };
+
+        enum ConstantKind : std::uint8_t {
+            RawConstant = 0,    // a non-object Value, stored as its bits
+            StringConstant = 1
+        };
+
+        struct FileHeader {
+            char magic[4];
+            std::uint32_t version;
+            std::uint32_t compiler;
+            std::uint64_t natives;
+            std::uint64_t source_hash;
+            std::uint64_t source_size;
+            std::uint32_t register_count;
+            std::uint32_t code_count;
+            std::uint32_t constant_count;
+            std::uint32_t import_count;
+            std::uint32_t position_count;
+            std::uint32_t statement_count;
+        };
+
+        static_assert(std::is_trivially_copyable_v<FileHeader>);
+        static_assert(std::is_trivially_copyable_v<Instruction>);
+        static_assert(std::is_trivially_copyable_v<SourcePosition>);
+
+        template <typename T>
+        void put(std::string& out, const T& value) {
+            out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void put_string(std::string& out, std::string_view text) {
+            put(out, static_cast<std::uint32_t>(text.size()));
+            out.append(text);
+        }
+
+        // Bounds-checked cursor over a file's bytes
+        struct Reader {
+            const char* at;
+            const char* end;
+
+            bool bytes(void* out, std::size_t size) {
+                if (static_cast<std::size_t>(end - at) < size) return false;
+                if (size > 0) std::memcpy(out, at, size);
+                at += size;
+                return true;
+            }
+
+            template <typename T>
+            bool get(T& out) { return bytes(&out, sizeof(T)); }
+
+            bool get_string(std::string_view& out) {
+                std::uint32_t size;
+                if (!get(size) || static_cast<std::size_t>(end - at) < size) return false;
+                out = std::string_view(at, size);
+                at += size;
+                return true;
+            }
+        };
+
+        bool valid_raw_constant(Value value) {
+            return value.is_double() || value.is_int() || value.is_bool() || value.is_nil();
+        }
+
+        // Both tables are searched by pc, so they must be sorted and point into the code
+        // and the source. Positions have one entry per pc; statements that emit no code
+        // share their successor's.
+        bool verify_positions(const std::vector<SourcePosition>& table, bool strictly_ascending,
+                              std::size_t code_size, std::size_t source_size) {
+            for (std::size_t i = 0; i < table.size(); ++i) {
+                const SourcePosition& position = table[i];
+                if (position.pc >= code_size) return false;
+                if (position.offset != no_source_offset && position.offset >= source_size) return false;
+                if (i > 0 && (position.pc < table[i - 1].pc || (strictly_ascending && position.pc == table[i - 1].pc))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool verify(const Chunk& chunk) {
+            const std::uint32_t registers = chunk.register_count;
+            const std::size_t code_size = chunk.code.size();
+            if (registers > max_registers || code_size == 0 || chunk.code.back().op != OpCode::Halt) {
+                return false;
+            }
+
+            for (const Instruction& in : chunk.code) {
+                switch (in.op) {
+                    case OpCode::LoadK:
+                        if (in.a >= registers || in.bx() >= chunk.constants.size()) return false;
+                        break;
+                    case OpCode::LoadNil:
+                        if (in.a >= registers) return false;
+                        break;
+                    case OpCode::Move:
+                    case OpCode::Negate:
+                    case OpCode::Not:
+                    case OpCode::Bool:
+                        if (in.a >= registers || in.b >= registers) return false;
+                        break;
+                    case OpCode::Add:
+                    case OpCode::Subtract:
+                    case OpCode::Multiply:
+                    case OpCode::Divide:
+                    case OpCode::Modulo:
+                    case OpCode::Less:
+                    case OpCode::LessEqual:
+                    case OpCode::Greater:
+                    case OpCode::GreaterEqual:
+                    case OpCode::Equal:
+                    case OpCode::NotEqual:
+                        if (in.a >= registers || in.b >= registers || in.c >= registers) return false;
+                        break;
+                    case OpCode::Jump:
+                        if (in.bx() >= code_size) return false;
+                        break;
+                    case OpCode::JumpIfFalse:
+                    case OpCode::JumpIfTrue:
+                        if (in.a >= registers || in.bx() >= code_size) return false;
+                        break;
+                    case OpCode::CallNative: {
+                        // The result register always exists, even for a call without arguments
+                        if (in.a >= registers || in.a + in.c > registers || in.b >= chunk.imports.size()) return false;
+                        int arity = chunk.imports[in.b].arity;
+                        if (arity != variadic && arity != in.c) return false;
+                        break;
+                    }
+                    case OpCode::Halt:
+                        break;
+                    default:
+                        return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    std::uint64_t hash_source(std::string_view source) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (char c : source) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    std::string serialize_program(const Program& program, std::string_view source, std::uint64_t natives) {
+        const Chunk& chunk = program.chunk;
+
+        FileHeader header{};
+        std::memcpy(header.magic, magic, sizeof(magic));
+        header.version = program_format_version;
+        header.compiler = compiler_version;
+        header.natives = natives;
+        header.source_hash = hash_source(source);
+        header.source_size = source.size();
+        header.register_count = chunk.register_count;
+        header.code_count = static_cast<std::uint32_t>(chunk.code.size());
+        header.constant_count = static_cast<std::uint32_t>(chunk.constants.size());
+        header.import_count = static_cast<std::uint32_t>(chunk.imports.size());
+        header.position_count = static_cast<std::uint32_t>(chunk.positions.size());
+        header.statement_count = static_cast<std::uint32_t>(chunk.statements.size());
+
+        std::string out;
+        out.reserve(sizeof(header) + source.size() + chunk.code.size() * sizeof(Instruction) + chunk.constants.size() * 9);
+        put(out, header);
+        out.append(source);
+        out.append(reinterpret_cast<const char*>(chunk.code.data()), chunk.code.size() * sizeof(Instruction));
+
+        for (Value constant : chunk.constants) {
+            if (constant.is_string()) {
+                put(out, StringConstant);
+                put_string(out, constant.as_string()->view());
+            }
+            else {
+                put(out, RawConstant);
+                put(out, constant.bits());
+            }
+        }
+
+        for (const NativeImport& import : chunk.imports) {
+            put(out, static_cast<std::int32_t>(import.arity));
+            put_string(out, import.name);
+        }
+
+        out.append(reinterpret_cast<const char*>(chunk.positions.data()), chunk.positions.size() * sizeof(SourcePosition));
+        out.append(reinterpret_cast<const char*>(chunk.statements.data()), chunk.statements.size() * sizeof(SourcePosition));
+        return out;
+    }
+
+    std::unique_ptr<Program> deserialize_program(std::string_view data, std::string_view source, std::uint64_t natives) {
+        Reader reader{ data.data(), data.data() + data.size() };
+
+        FileHeader header;
+        if (!reader.get(header)
+            || std::memcmp(header.magic, magic, sizeof(magic)) != 0
+            || header.version != program_format_version
+            || header.compiler != compiler_version
+            || header.natives != natives
+            || header.source_size != source.size()
+            || header.source_hash != hash_source(source)) {
+            return nullptr;
+        }
+
+        // The hash only narrows it down; the entry must have been compiled from this text
+        if (static_cast<std::size_t>(reader.end - reader.at) < source.size()
+            || std::memcmp(reader.at, source.data(), source.size()) != 0) {
+            return nullptr;
+        }
+        reader.at += source.size();
+
+        // Counts are untrusted; never reserve more than the file could hold
+        if (header.code_count > data.size() / sizeof(Instruction)
+            || header.constant_count > data.size()
+            || header.import_count > data.size()
+            || header.position_count > data.size() / sizeof(SourcePosition)
+            || header.statement_count > data.size() / sizeof(SourcePosition)) {
+            return nullptr;
+        }
+
+        auto program = std::make_unique<Program>();
+        Chunk& chunk = program->chunk;
+        chunk.register_count = header.register_count;
+
+        chunk.code.resize(header.code_count);
+        if (!reader.bytes(chunk.code.data(), chunk.code.size() * sizeof(Instruction))) {
+            return nullptr;
+        }
+
+        chunk.constants.reserve(header.constant_count);
+        for (std::uint32_t i = 0; i < header.constant_count; ++i) {
+            std::uint8_t kind;
+            if (!reader.get(kind)) return nullptr;
+
+            if (kind == StringConstant) {
+                std::string_view text;
+                if (!reader.get_string(text)) return nullptr;
+                chunk.constants.push_back(Value::object(program->heap.intern(text)));
+            }
+            else {
+                std::uint64_t bits;
+                if (kind != RawConstant || !reader.get(bits)) return nullptr;
+                Value value = Value::from_bits(bits);
+                if (!valid_raw_constant(value)) return nullptr;
+                chunk.constants.push_back(value);
+            }
+        }
+
+        chunk.imports.reserve(header.import_count);
+        for (std::uint32_t i = 0; i < header.import_count; ++i) {
+            std::int32_t arity;
+            std::string_view name;
+            if (!reader.get(arity) || !reader.get_string(name) || name.empty() || arity < variadic) {
+                return nullptr;
+            }
+            chunk.imports.push_back({ std::string(name), arity, NativeRegistry::npos });
+        }
+
+        chunk.positions.resize(header.position_count);
+        chunk.statements.resize(header.statement_count);
+        if (!reader.bytes(chunk.positions.data(), chunk.positions.size() * sizeof(SourcePosition))
+            || !reader.bytes(chunk.statements.data(), chunk.statements.size() * sizeof(SourcePosition))) {
+            return nullptr;
+        }
+
+        if (reader.at != reader.end
+            || !verify(chunk)
+            || !verify_positions(chunk.positions, true, chunk.code.size(), source.size())
+            || !verify_positions(chunk.statements, false, chunk.code.size(), source.size())) {
+            return nullptr;
+        }
+        return program;
+    }
+
+    ProgramCache::ProgramCache(std::filesystem::path directory)
+        : directory_(std::move(directory)) {}
+
+    std::filesystem::path ProgramCache::default_directory() {
+#ifdef _WIN32
+        if (const char* local = std::getenv("LOCALAPPDATA"); local && *local) {
+            return std::filesystem::path(local) / "breezy" / "cache";
+        }
+#else
+        // The XDG spec says relative paths are invalid and must be ignored
+        if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg == '/') {
+            return std::filesystem::path(xdg) / "breezy";
+        }
+        if (const char* home = std::getenv("HOME"); home && *home) {
+            return std::filesystem::path(home) / ".cache" / "breezy";
+        }
+#endif
+        return {};
+    }
+
+    std::unique_ptr<Program> ProgramCache::load(std::string_view source, std::uint64_t natives) const {
+        MappedFile file;
+        if (!file.open(entry(hash_source(source), natives))) {
+            return nullptr;
+        }
+        return deserialize_program(file.view(), source, natives);
+    }
+
+    void ProgramCache::store(const Program& program, std::string_view source, std::uint64_t natives) const {
+        std::uint64_t hash = hash_source(source);
+        std::string data = serialize_program(program, source, natives);
+
+        std::error_code error;
+        std::filesystem::create_directories(directory_, error);
+        if (error) return;
+
+        // A unique temporary name, so racing writers never share a file
+        std::filesystem::path target = entry(hash, natives);
+        std::filesystem::path temporary = target;
+        temporary += "." + std::to_string(std::random_device{}()) + ".tmp";
+
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        out.close();
+        if (!out) {
+            std::filesystem::remove(temporary, error);
+            return;
+        }
+
+        std::filesystem::rename(temporary, target, error);
+        if (error) {
+            std::filesystem::remove(temporary, error);
+        }
+    }
+
+    std::filesystem::path ProgramCache::entry(std::uint64_t source_hash, std::uint64_t natives) const {
+        static constexpr char digits[] = "0123456789abcdef";
+
+        std::string name(33, '-');
+        for (int i = 15; i >= 0; --i, source_hash >>= 4, natives >>= 4) {
+            name[i] = digits[source_hash & 0xF];
+            name[17 + i] = digits[natives & 0xF];
+        }
+        // Versions and registries get separate entries, so runtimes that differ in
+        // either and share a cache do not keep overwriting each other
+        return directory_ / (name + "-v" + std::to_string(program_format_version)
+                             + "-c" + std::to_string(compiler_version) + ".bzc");
+    }
+}
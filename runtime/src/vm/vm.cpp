@@ -0,0 +1,271 @@
+/*
+    =============================================================================================
+    Copyright 2025 Bryan Sanchez
+
+    Redistribution and use in source and binary forms, with or without modification, 
+    are permitted provided that the following conditions are met:
+
+    1.  Redistributions of source code must retain the above copyright notice, this list of 
+        conditions and the following disclaimer.
+
+    2.  Redistributions in binary form must reproduce the above copyright notice, this list of 
+        conditions and the following disclaimer in the documentation and/or other materials 
+        provided with the distribution.
+
+    3.  Neither the name of the copyright holder nor the names of its contributors may be used to 
+        endorse or promote products derived from this software without specific prior written 
+        permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+    IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY 
+    AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER 
+    IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT 
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ============================================================================================
+*/
+
+#include "breezy/vm/vm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "breezy/frontend/operators.hpp"
+
+#if defined(__GNUC__) && !defined(BREEZY_VM_SWITCH_DISPATCH)
+#  define BREEZY_VM_COMPUTED_GOTO 1
+#endif
+
+namespace breezy::runtime {
+    namespace {
+        inline bool both_int(Value a, Value b) { return a.is_int() && b.is_int(); }
+        inline bool both_number(Value a, Value b) { return a.is_number() && b.is_number(); }
+
+        // Traced dispatch: the span of the top-level statement being executed, recorded
+        // when the next one starts or the run ends
+        struct StatementSpan {
+            TraceBuffer* trace;
+            std::uint32_t offset = TraceBuffer::none;
+            std::uint64_t start = 0;
+
+            void enter(std::uint32_t next) {
+                if (offset != TraceBuffer::none) trace->record("statement", "statement", start, offset);
+                offset = next;
+                start = TraceBuffer::now();
+            }
+
+            ~StatementSpan() {
+                if (trace && offset != TraceBuffer::none) trace->record("statement", "statement", start, offset);
+            }
+        };
+    }
+
+    VirtualMachine::VirtualMachine(Heap& heap, const NativeRegistry& natives, OutputSink& output, std::vector<Value>& registers,
+                                   RuntimeStats& stats)
+        : heap_(heap), natives_(natives), output_(output), registers_(registers), stats_(stats) {}
+
+    Value VirtualMachine::unary_slow(UnaryOp op, Value operand) {
+        Value result;
+        if (!evaluate_unary(op, operand, result)) {
+            throw std::runtime_error(operand_error(op, operand));
+        }
+        return result;
+    }
+
+    Value VirtualMachine::binary_slow(BinaryOp op, Value left, Value right) {
+        Value result;
+        if (!evaluate_binary(op, left, right, &heap_, result)) {
+            throw std::runtime_error(operand_error(op, left, right));
+        }
+        return result;
+    }
+
+    void VirtualMachine::run(const Chunk& chunk, const std::vector<std::uint32_t>& links, std::uint32_t pc) {
+        if (trace_) {
+            if (probe_) dispatch<true, true>(chunk, links, pc);
+            else        dispatch<false, true>(chunk, links, pc);
+        }
+        else {
+            if (probe_) dispatch<true, false>(chunk, links, pc);
+            else        dispatch<false, false>(chunk, links, pc);
+        }
+    }
+
+    template <bool Probed, bool Traced>
+    void VirtualMachine::dispatch(const Chunk& chunk, const std::vector<std::uint32_t>& links, std::uint32_t pc) {
+        if (registers_.size() < chunk.register_count) {
+            registers_.resize(chunk.register_count);
+        }
+
+        Value* R = registers_.data();
+        const Value* K = chunk.constants.data();
+        const std::uint32_t* imports = links.data();
+        const Instruction* code = chunk.code.data();
+        const Instruction* ip = code + pc;
+        Instruction in;
+
+        // Statements before `pc` were run, or skipped, by an earlier call
+        [[maybe_unused]] const SourcePosition* statements_end = chunk.statements.data() + chunk.statements.size();
+        [[maybe_unused]] const SourcePosition* next_statement = std::lower_bound(chunk.statements.data(), statements_end, pc,
+            [](const SourcePosition& position, std::uint32_t target) { return position.pc < target; });
+        StatementSpan statement{ Traced ? trace_ : nullptr };
+
+#ifdef BREEZY_STATS
+        // Counted in a local and added to the totals however the run ends
+        struct InstructionCount {
+            std::uint64_t& total;
+            std::uint64_t count = 0;
+            ~InstructionCount() { total += count; }
+        } executed{ stats_.instructions_executed };
+#endif
+
+#define VM_FETCH()                                                                      \
+        do {                                                                            \
+            if constexpr (Probed) probe_->enter(static_cast<std::uint32_t>(ip - code)); \
+            if constexpr (Traced) {                                                     \
+                while (next_statement != statements_end                                 \
+                       && static_cast<std::uint32_t>(ip - code) >= next_statement->pc)  \
+                    statement.enter((next_statement++)->offset);                        \
+            }                                                                           \
+            in = *ip++;                                                                 \
+            BREEZY_STAT(++executed.count);                                              \
+        } while (0)
+
+        // The handler only runs on an error, so the loop pays nothing for it; `ip` has
+        // already moved past the instruction that threw
+        try {
+#if BREEZY_VM_COMPUTED_GOTO
+        // Must list every OpCode, in declaration order
+        static void* const dispatch_table[] = {
+            &&op_LoadK, &&op_LoadNil, &&op_Move,
+            &&op_Negate, &&op_Not, &&op_Bool,
+            &&op_Add, &&op_Subtract, &&op_Multiply, &&op_Divide, &&op_Modulo,
+            &&op_Less, &&op_LessEqual, &&op_Greater, &&op_GreaterEqual, &&op_Equal, &&op_NotEqual,
+            &&op_Jump, &&op_JumpIfFalse, &&op_JumpIfTrue,
+            &&op_CallNative, &&op_Halt
+        };
+        static_assert(sizeof(dispatch_table) / sizeof(dispatch_table[0]) == static_cast<std::size_t>(OpCode::Count),
+                      "dispatch table out of sync with OpCode");
+
+#  define VM_CASE(name) op_##name:
+#  define VM_NEXT() do { VM_FETCH(); goto *dispatch_table[static_cast<std::size_t>(in.op)]; } while (0)
+
+        VM_NEXT();
+#else
+#  define VM_CASE(name) case OpCode::name:
+#  define VM_NEXT() break
+
+        for (;;) {
+            VM_FETCH();
+            switch (in.op) {
+#endif
+
+// int32 results are computed in 64 bits and fall back to double on overflow.
+#define VM_ARITHMETIC(name, op)                                                         \
+        VM_CASE(name) {                                                                 \
+            Value l = R[in.b], r = R[in.c];                                             \
+            if (both_int(l, r))                                                         \
+                R[in.a] = Value::from_int64(std::int64_t(l.as_int()) op r.as_int());    \
+            else if (both_number(l, r))                                                 \
+                R[in.a] = Value::number(l.to_double() op r.to_double());                \
+            else                                                                        \
+                R[in.a] = binary_slow(BinaryOp::name, l, r);                            \
+            VM_NEXT();                                                                  \
+        }
+
+#define VM_COMPARISON(name, op)                                                         \
+        VM_CASE(name) {                                                                 \
+            Value l = R[in.b], r = R[in.c];                                             \
+            if (both_int(l, r))                                                         \
+                R[in.a] = Value::boolean(l.as_int() op r.as_int());                     \
+            else if (both_number(l, r))                                                 \
+                R[in.a] = Value::boolean(l.to_double() op r.to_double());               \
+            else                                                                        \
+                R[in.a] = binary_slow(BinaryOp::name, l, r);                            \
+            VM_NEXT();                                                                  \
+        }
+
+        VM_CASE(LoadK)        R[in.a] = K[in.bx()];                                     VM_NEXT();
+        VM_CASE(LoadNil)      R[in.a] = Value::nil();                                   VM_NEXT();
+        VM_CASE(Move)         R[in.a] = R[in.b];                                        VM_NEXT();
+
+        VM_CASE(Negate) {
+            Value v = R[in.b];
+            if (v.is_double()) R[in.a] = Value::number(-v.as_double());
+            else               R[in.a] = unary_slow(UnaryOp::Negate, v);
+            VM_NEXT();
+        }
+        VM_CASE(Not)          R[in.a] = Value::boolean(!R[in.b].truthy());              VM_NEXT();
+        VM_CASE(Bool)         R[in.a] = Value::boolean(R[in.b].truthy());               VM_NEXT();
+
+        VM_ARITHMETIC(Add, +)
+        VM_ARITHMETIC(Subtract, -)
+        VM_ARITHMETIC(Multiply, *)
+
+        VM_CASE(Divide) {
+            Value l = R[in.b], r = R[in.c];
+            if (both_number(l, r))
+                R[in.a] = Value::number(l.to_double() / r.to_double());
+            else
+                R[in.a] = binary_slow(BinaryOp::Divide, l, r);
+            VM_NEXT();
+        }
+        VM_CASE(Modulo) {
+            Value l = R[in.b], r = R[in.c];
+            if (both_int(l, r) && r.as_int() != 0)
+                R[in.a] = Value::from_int64(std::int64_t(l.as_int()) % r.as_int());
+            else if (both_number(l, r))
+                R[in.a] = Value::number(std::fmod(l.to_double(), r.to_double()));
+            else
+                R[in.a] = binary_slow(BinaryOp::Modulo, l, r);
+            VM_NEXT();
+        }
+
+        VM_COMPARISON(Less, <)
+        VM_COMPARISON(LessEqual, <=)
+        VM_COMPARISON(Greater, >)
+        VM_COMPARISON(GreaterEqual, >=)
+
+        VM_CASE(Equal)        R[in.a] = Value::boolean(values_equal(R[in.b], R[in.c]));  VM_NEXT();
+        VM_CASE(NotEqual)     R[in.a] = Value::boolean(!values_equal(R[in.b], R[in.c])); VM_NEXT();
+
+        VM_CASE(Jump)         ip = code + in.bx();                                      VM_NEXT();
+        VM_CASE(JumpIfFalse)  if (!R[in.a].truthy()) ip = code + in.bx();               VM_NEXT();
+        VM_CASE(JumpIfTrue)   if (R[in.a].truthy()) ip = code + in.bx();                VM_NEXT();
+
+        VM_CASE(CallNative) {
+            NativeCall call{ heap_, output_, natives_[imports[in.b]] };
+            BREEZY_STAT(++stats_.native_calls);
+            if constexpr (Probed) probe_->enter_native(imports[in.b]);
+            [[maybe_unused]] std::uint64_t start = Traced ? TraceBuffer::now() : 0;
+            R[in.a] = call.native.function(call, R + in.a, in.c);
+            if constexpr (Traced) trace_->record(call.native.name, "native", start);
+            if constexpr (Probed) probe_->leave_native();
+            VM_NEXT();
+        }
+
+        VM_CASE(Halt) return;
+
+#if !BREEZY_VM_COMPUTED_GOTO
+                case OpCode::Count: return;
+            }
+        }
+#endif
+        }
+        catch (const std::runtime_error&) {
+            failed_pc_ = static_cast<std::uint32_t>(ip - code) - 1;
+            if constexpr (Probed) probe_->leave_native();
+            throw;
+        }
+
+#undef VM_ARITHMETIC
+#undef VM_COMPARISON
+#undef VM_CASE
+#undef VM_NEXT
+#undef VM_FETCH
+    }
+}